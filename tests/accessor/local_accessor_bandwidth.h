@@ -0,0 +1,260 @@
+/*******************************************************************************
+//
+//  SYCL 2020 Conformance Test Suite
+//
+//  Copyright (c) 2026 The Khronos Group Inc.
+//
+//  Licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//
+*******************************************************************************/
+
+//  Provides performance tests for the memory shared among work-items through
+//  sycl::local_accessor. The kernels have the same shape as the
+//  local_accessor_access_among_work_items tests: every round each work-item
+//  writes a local memory slot, waits on group_barrier, reads the slot written
+//  by its neighbour and waits again. The slots are laid out with different
+//  strides to expose bank conflicts.
+
+#ifndef SYCL_CTS_LOCAL_ACCESSOR_BANDWIDTH_H
+#define SYCL_CTS_LOCAL_ACCESSOR_BANDWIDTH_H
+#include "../common/benchmark.h"
+#include "../common/get_group_range.h"
+#include "accessor_common.h"
+
+namespace local_accessor_bandwidth {
+using namespace sycl_cts;
+using namespace accessor_tests_common;
+
+/** Number of write/read rounds of a single kernel run */
+constexpr size_t rounds = 256;
+
+/** Upper limit of the work-group size used for the measurements */
+constexpr size_t max_work_group_size = 256;
+
+/** Number of timed runs for every access pattern */
+constexpr size_t sample_count = 20;
+
+/**
+ * @brief Local memory access patterns. Work-item with local linear id k uses
+ *        slot (k * stride) % N + (k * stride) / N, where N is the work-group
+ *        size, so neighbouring work-items access addresses stride elements
+ *        apart. Strides are only used when they divide N and are less than N.
+ */
+enum class access_pattern : int {
+  contiguous = 0,
+  stride_2,
+  stride_16,
+  stride_32,
+  broadcast,     // every work-item reads the slot of work-item 0
+  barrier_only,  // no local memory accesses, only the group barriers
+  pattern_count  // defines size, should be last
+};
+
+inline size_t get_stride(access_pattern pattern) {
+  switch (pattern) {
+    case access_pattern::stride_2:
+      return 2;
+    case access_pattern::stride_16:
+      return 16;
+    case access_pattern::stride_32:
+      return 32;
+    default:
+      return 1;
+  }
+}
+
+inline std::string get_pattern_name(access_pattern pattern) {
+  switch (pattern) {
+    case access_pattern::contiguous:
+      return "contiguous";
+    case access_pattern::stride_2:
+      return "stride 2";
+    case access_pattern::stride_16:
+      return "stride 16";
+    case access_pattern::stride_32:
+      return "stride 32";
+    case access_pattern::broadcast:
+      return "broadcast";
+    case access_pattern::barrier_only:
+      return "group_barrier only";
+    default:
+      return "unknown";
+  }
+}
+
+/**
+ * @brief Converts linear index to sycl::id within \p range, row-major
+ */
+template <int Dimension>
+sycl::id<Dimension> linear_to_id(size_t linear,
+                                 const sycl::range<Dimension>& range) {
+  sycl::id<Dimension> id;
+  for (int i = Dimension - 1; i >= 0; --i) {
+    id[i] = linear % range[i];
+    linear /= range[i];
+  }
+  return id;
+}
+
+template <typename T, typename DimensionTypeT>
+class kernel_local_accessor_bandwidth;
+
+/**
+ * @brief Provides a functor that measures local memory bandwidth and barrier
+ *        cost for the given type and dimension
+ * @tparam T Current data type
+ * @tparam DimensionTypeT Current dimension size
+ */
+template <typename T, typename DimensionTypeT>
+class run_test {
+  static constexpr int Dimension = DimensionTypeT::value;
+
+  /**
+   * @brief Runs kernel with \p round_count rounds and returns whether every
+   *        work-item ended up with the expected value
+   */
+  static void run_kernel(sycl::queue& queue, sycl::buffer<int, 1>& res_buf,
+                         const sycl::nd_range<Dimension>& range,
+                         access_pattern pattern, size_t round_count) {
+    queue
+        .submit([&](sycl::handler& cgh) {
+          sycl::accessor res_acc{res_buf, cgh, sycl::write_only,
+                                 sycl::no_init};
+          const auto local_range = range.get_local_range();
+          sycl::local_accessor<T, Dimension> acc(local_range, cgh);
+          cgh.parallel_for<kernel_local_accessor_bandwidth<T, DimensionTypeT>>(
+              range, [=](sycl::nd_item<Dimension> item) {
+                const size_t n = local_range.size();
+                const size_t stride = get_stride(pattern);
+                const size_t llid = item.get_local_linear_id();
+                auto slot = [=](size_t k) {
+                  const size_t linear = k * stride;
+                  return linear_to_id(linear % n + linear / n, local_range);
+                };
+                const auto write_id = slot(llid);
+                const auto read_id = pattern == access_pattern::broadcast
+                                         ? slot(0)
+                                         : slot((llid + 1) % n);
+
+                T value = value_operations::init<T>(static_cast<int>(llid));
+                for (size_t r = 0; r < round_count; ++r) {
+                  if (pattern != access_pattern::barrier_only)
+                    acc[write_id] = value;
+                  sycl::group_barrier(item.get_group());
+                  if (pattern != access_pattern::barrier_only)
+                    value = acc[read_id];
+                  sycl::group_barrier(item.get_group());
+                }
+
+                size_t expected = llid;
+                if (pattern == access_pattern::broadcast && round_count > 0)
+                  expected = 0;
+                else if (pattern != access_pattern::barrier_only)
+                  expected = (llid + round_count) % n;
+                res_acc[item.get_global_linear_id()] =
+                    value_operations::are_equal(
+                        value,
+                        value_operations::init<T>(static_cast<int>(expected)));
+              });
+        })
+        .wait_and_throw();
+  }
+
+ public:
+  /**
+   * @brief Functor that measures local memory bandwidth and barrier cost
+   * @param type_name Current data type string representation
+   */
+  void operator()(const std::string& type_name) {
+    auto queue = once_per_unit::get_queue();
+    const auto device = queue.get_device();
+
+    auto section_name = get_section_name<Dimension>(
+        type_name, "Measure local memory bandwidth. [local_accessor]");
+    SECTION(section_name) {
+      const auto local_range =
+          util::work_group_range<Dimension>(queue, max_work_group_size);
+      const size_t n = local_range.size();
+      if (n * sizeof(T) >
+          device.get_info<sycl::info::device::local_mem_size>()) {
+        WARN("Not enough local memory for " << n << " elements. Skipping.");
+        return;
+      }
+      auto global_range = local_range;
+      global_range[0] *=
+          4 * device.get_info<sycl::info::device::max_compute_units>();
+      const sycl::nd_range<Dimension> range{global_range, local_range};
+      sycl::buffer<int, 1> res_buf{global_range.size()};
+
+      for (int p = 0; p < to_integral(access_pattern::pattern_count); ++p) {
+        const auto pattern = static_cast<access_pattern>(p);
+        const size_t stride = get_stride(pattern);
+        // With stride >= N the slot mapping is the identity, so the pattern
+        // would measure contiguous access
+        if (stride > 1 && (stride >= n || n % stride != 0)) continue;
+        const std::string name = get_pattern_name(pattern) + ", T = " +
+                                 type_name + ", dims = " +
+                                 std::to_string(Dimension);
+        INFO(name);
+
+        const auto empty = util::benchmark::measure(sample_count, [&] {
+          run_kernel(queue, res_buf, range, pattern, 0);
+        });
+        const auto full = util::benchmark::measure(sample_count, [&] {
+          run_kernel(queue, res_buf, range, pattern, rounds);
+        });
+        {
+          sycl::host_accessor res_acc{res_buf, sycl::read_only};
+          CHECK(std::all_of(res_acc.begin(), res_acc.end(),
+                            [](int ok) { return ok != 0; }));
+        }
+
+        const double rounds_ns = std::max(full.p50 - empty.p50, 0.0);
+        util::benchmark::report(name + ", kernel", full);
+        if (pattern == access_pattern::barrier_only) {
+          WARN("[perf] " << name << ": group_barrier "
+                         << util::benchmark::format_duration(rounds_ns /
+                                                             (2 * rounds)));
+        } else {
+          // One write and one read of T per work-item and round
+          const double bytes =
+              2.0 * sizeof(T) * global_range.size() * rounds;
+          WARN("[perf] " << name << ": local memory "
+                         << util::benchmark::format_rate(bytes, rounds_ns,
+                                                         "B")
+                         << " including barriers");
+        }
+      }
+    }
+  }
+};
+
+using test_combinations = typename get_combinations<dimensions_pack>::type;
+
+template <typename T, typename ArgCombination>
+class run_local_accessor_bandwidth_tests {
+ public:
+  void operator()(const std::string& type_name) {
+    // Get the packs from the test combination type.
+    using DimensionsPack = std::tuple_element_t<0, ArgCombination>;
+
+    // Type packs instances have to be const, otherwise for_all_combination
+    // will not compile
+    const auto dimensions = DimensionsPack::generate_unnamed();
+
+    for_all_combinations<run_test, T>(dimensions, type_name);
+  }
+};
+}  // namespace local_accessor_bandwidth
+
+#endif  // SYCL_CTS_LOCAL_ACCESSOR_BANDWIDTH_H
@@ -0,0 +1,32 @@
+/*******************************************************************************
+//
+//  SYCL 2020 Conformance Test Suite
+//
+//  Provides performance tests for local_accessor.
+//
+//  This test measures local memory bandwidth with strided and conflicting
+//  access patterns and the cost of group_barrier. For generic types.
+//
+*******************************************************************************/
+
+#include "../common/common.h"
+#include "../common/disabled_for_test_case.h"
+
+// FIXME: re-enable when sycl::accessor is implemented
+#if !SYCL_CTS_COMPILING_WITH_HIPSYCL
+
+#include "local_accessor_bandwidth.h"
+
+using namespace local_accessor_bandwidth;
+using namespace accessor_tests_common;
+#endif
+
+namespace local_accessor_bandwidth_core {
+
+DISABLED_FOR_TEMPLATE_LIST_TEST_CASE(hipSYCL)
+("sycl::local_accessor bandwidth. core types", "[accessor][perf]",
+ test_combinations)({
+  common_run_tests<run_local_accessor_bandwidth_tests, TestType>();
+});
+
+}  // namespace local_accessor_bandwidth_core
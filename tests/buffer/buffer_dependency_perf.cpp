@@ -0,0 +1,295 @@
+/*******************************************************************************
+//
+//  SYCL 2020 Conformance Test Suite
+//
+//  Copyright (c) 2026 The Khronos Group Inc.
+//
+//  Licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//
+//  Measures the cost of the implicit dependency tracking of buffers. Kernels
+//  access the same buffer, disjoint buffers or disjoint sub-buffers of one
+//  parent with read, write, write + no_init and read_write access, and the
+//  values they read or leave behind are verified. The test reports
+//  the time of every submission and whether kernels without a data
+//  dependency actually run concurrently on an out-of-order queue.
+//
+*******************************************************************************/
+
+#include "../common/benchmark.h"
+#include "../common/common.h"
+#include "../common/once_per_unit.h"
+
+#include <algorithm>
+
+namespace buffer_dependency_perf {
+using namespace sycl_cts::util;
+
+/** Number of kernels submitted to measure the scheduling overhead */
+constexpr size_t overhead_commands = 2000;
+
+/** Number of disjoint buffers and sub-buffers */
+constexpr size_t target_count = 64;
+
+/** Number of long kernels used to detect concurrent execution */
+constexpr size_t concurrent_commands = 8;
+
+/** Long kernels are calibrated to take at least this long, ns */
+constexpr double long_kernel_ns = 5e6;
+
+/** Value the targets hold before the kernels run */
+constexpr unsigned initial_value = 7;
+
+enum class access_kind { read, write, write_no_init, read_write };
+
+std::string get_access_name(access_kind kind) {
+  switch (kind) {
+    case access_kind::read:
+      return "read";
+    case access_kind::write:
+      return "write";
+    case access_kind::write_no_init:
+      return "write + no_init";
+    default:
+      return "read_write";
+  }
+}
+
+/**
+ * @brief Returns \p value after \p iterations steps of a generator, used to
+ *        make kernels run for a given time
+ */
+inline unsigned spin(unsigned value, unsigned iterations) {
+  for (unsigned i = 0; i < iterations; ++i)
+    value = value * 1664525u + 1013904223u;
+  return value;
+}
+
+template <access_kind Kind>
+class access_kernel;
+
+/**
+ * @brief Submits a kernel accessing the first elements of \p buf. Kernels
+ *        reading \p buf write their result to \p out, which is never shared
+ *        between kernels that may run at the same time.
+ */
+template <access_kind Kind>
+void submit_access(sycl::queue& queue, sycl::buffer<unsigned, 1>& buf,
+                   sycl::buffer<unsigned, 1>& out, unsigned index,
+                   unsigned iterations) {
+  queue.submit([&](sycl::handler& cgh) {
+    if constexpr (Kind == access_kind::read) {
+      sycl::accessor acc{buf, cgh, sycl::read_only};
+      sycl::accessor out_acc{out, cgh, sycl::write_only, sycl::no_init};
+      cgh.single_task<access_kernel<Kind>>(
+          [=] { out_acc[0] = spin(acc[0], iterations); });
+    } else if constexpr (Kind == access_kind::write) {
+      sycl::accessor acc{buf, cgh, sycl::write_only};
+      cgh.single_task<access_kernel<Kind>>([=] {
+        acc[0] = index;
+        acc[1] = spin(index, iterations);
+      });
+    } else if constexpr (Kind == access_kind::write_no_init) {
+      sycl::accessor acc{buf, cgh, sycl::write_only, sycl::no_init};
+      cgh.single_task<access_kernel<Kind>>([=] {
+        acc[0] = index;
+        acc[1] = spin(index, iterations);
+      });
+    } else {
+      sycl::accessor acc{buf, cgh, sycl::read_write};
+      cgh.single_task<access_kernel<Kind>>([=] {
+        acc[0] += 1;
+        acc[1] = spin(acc[1], iterations);
+      });
+    }
+  });
+}
+
+/**
+ * @brief Buffers accessed by the kernels; kernel i accesses
+ *        targets[i % targets.size()]
+ */
+struct scenario {
+  std::string name;
+  std::vector<sycl::buffer<unsigned, 1>> targets;
+};
+
+/**
+ * @brief Sets every element of \p targets to \p value
+ */
+void reset(std::vector<sycl::buffer<unsigned, 1>>& targets,
+           unsigned value = initial_value) {
+  for (auto& target : targets) {
+    sycl::host_accessor acc{target, sycl::write_only};
+    std::fill(acc.begin(), acc.end(), value);
+  }
+}
+
+/**
+ * @brief Submits \p commands kernels and waits for them
+ * @param submit_ns If not null, receives the duration of every submission
+ * @retval Time from the first submission to the end of the wait
+ */
+template <access_kind Kind>
+double run_commands(sycl::queue& queue, scenario& test,
+                    std::vector<sycl::buffer<unsigned, 1>>& outputs,
+                    size_t commands, unsigned iterations,
+                    std::vector<double>* submit_ns = nullptr) {
+  return benchmark::time_ns([&] {
+    for (size_t i = 0; i < commands; ++i) {
+      auto& target = test.targets[i % test.targets.size()];
+      auto& out = outputs[i % outputs.size()];
+      const double ns = benchmark::time_ns([&] {
+        submit_access<Kind>(queue, target, out, static_cast<unsigned>(i),
+                            iterations);
+      });
+      if (submit_ns) submit_ns->push_back(ns);
+    }
+    queue.wait_and_throw();
+  });
+}
+
+/**
+ * @brief Checks the values left in the targets and, for reading kernels, in
+ *        the outputs by run_commands()
+ */
+template <access_kind Kind>
+void check_targets(scenario& test,
+                   std::vector<sycl::buffer<unsigned, 1>>& outputs,
+                   size_t commands, unsigned iterations) {
+  if constexpr (Kind == access_kind::read) {
+    // Every output used holds the value read from the unmodified target
+    const size_t used = std::min(commands, outputs.size());
+    for (size_t o = 0; o < used; ++o) {
+      sycl::host_accessor acc{outputs[o], sycl::read_only};
+      CHECK(acc[0] == spin(initial_value, iterations));
+    }
+  }
+  const size_t count = test.targets.size();
+  for (size_t t = 0; t < count; ++t) {
+    sycl::host_accessor acc{test.targets[t], sycl::read_only};
+    if constexpr (Kind == access_kind::read) {
+      CHECK(acc[0] == initial_value);
+    } else if constexpr (Kind == access_kind::read_write) {
+      // Every kernel increments the first element of its target
+      CHECK(acc[0] == initial_value + (commands + count - 1 - t) / count);
+    } else {
+      // The last kernel accessing a target writes its index
+      if (t < commands) {
+        const size_t last = t + (commands - 1 - t) / count * count;
+        CHECK(acc[0] == last);
+      }
+    }
+  }
+}
+
+/**
+ * @brief Returns the number of generator steps that make a kernel run for at
+ *        least long_kernel_ns
+ */
+unsigned calibrate(sycl::queue& queue, scenario& test,
+                   std::vector<sycl::buffer<unsigned, 1>>& outputs) {
+  unsigned iterations = 1 << 10;
+  while (iterations < (1u << 30)) {
+    const double ns = benchmark::time_ns([&] {
+      submit_access<access_kind::read_write>(queue, test.targets[0],
+                                             outputs[0], 0, iterations);
+      queue.wait_and_throw();
+    });
+    if (ns >= long_kernel_ns) break;
+    iterations *= 2;
+  }
+  return iterations;
+}
+
+template <access_kind Kind>
+void measure_access(sycl::queue& queue, std::vector<scenario>& scenarios,
+                    std::vector<sycl::buffer<unsigned, 1>>& outputs,
+                    unsigned long_iterations) {
+  for (auto& test : scenarios) {
+    const std::string name = get_access_name(Kind) + ", " + test.name;
+    INFO(name);
+
+    reset(test.targets);
+    // A read kernel doing nothing leaves a value it cannot produce
+    reset(outputs, ~initial_value);
+    std::vector<double> submit_ns;
+    submit_ns.reserve(overhead_commands);
+    const double total_ns = run_commands<Kind>(
+        queue, test, outputs, overhead_commands, 0, &submit_ns);
+    check_targets<Kind>(test, outputs, overhead_commands, 0);
+    benchmark::report(name + ", submit",
+                      benchmark::get_stats(std::move(submit_ns)));
+    WARN("[perf] " << name << ": "
+                   << benchmark::format_rate(overhead_commands, total_ns,
+                                             "kernels")
+                   << " end to end");
+
+    // A single long kernel, then concurrent_commands of them
+    reset(test.targets);
+    reset(outputs, ~initial_value);
+    const double single_ns =
+        run_commands<Kind>(queue, test, outputs, 1, long_iterations);
+    check_targets<Kind>(test, outputs, 1, long_iterations);
+    reset(test.targets);
+    reset(outputs, ~initial_value);
+    const double batch_ns = run_commands<Kind>(
+        queue, test, outputs, concurrent_commands, long_iterations);
+    check_targets<Kind>(test, outputs, concurrent_commands, long_iterations);
+    const double speedup = concurrent_commands * single_ns / batch_ns;
+    WARN("[perf] " << name << ": " << concurrent_commands
+                   << " long kernels take "
+                   << benchmark::format_duration(batch_ns) << " vs "
+                   << benchmark::format_duration(single_ns)
+                   << " for one, effective concurrency " << speedup);
+  }
+}
+
+TEST_CASE("Implicit dependency tracking of buffers", "[buffer][perf]") {
+  auto queue = once_per_unit::get_queue();
+  const auto device = queue.get_device();
+
+  // Sub-buffer offsets have to be aligned to mem_base_addr_align bits
+  const size_t align_elements =
+      device.get_info<sycl::info::device::mem_base_addr_align>() / 8 /
+      sizeof(unsigned);
+  const size_t elements = std::max<size_t>(align_elements, 2);
+
+  sycl::buffer<unsigned, 1> parent{sycl::range<1>{elements * target_count}};
+  std::vector<sycl::buffer<unsigned, 1>> buffers;
+  std::vector<sycl::buffer<unsigned, 1>> sub_buffers;
+  std::vector<sycl::buffer<unsigned, 1>> outputs;
+  for (size_t i = 0; i < target_count; ++i) {
+    buffers.emplace_back(sycl::range<1>{elements});
+    sub_buffers.emplace_back(parent, sycl::id<1>{i * elements},
+                             sycl::range<1>{elements});
+    outputs.emplace_back(sycl::range<1>{1});
+  }
+
+  std::vector<scenario> scenarios{
+      {"same buffer", {buffers[0]}},
+      {"disjoint buffers", buffers},
+      {"disjoint sub-buffers of one buffer", sub_buffers}};
+  reset(buffers);
+  const unsigned long_iterations = calibrate(queue, scenarios[0], outputs);
+
+  measure_access<access_kind::read>(queue, scenarios, outputs,
+                                    long_iterations);
+  measure_access<access_kind::write>(queue, scenarios, outputs,
+                                     long_iterations);
+  measure_access<access_kind::write_no_init>(queue, scenarios, outputs,
+                                             long_iterations);
+  measure_access<access_kind::read_write>(queue, scenarios, outputs,
+                                          long_iterations);
+}
+
+}  // namespace buffer_dependency_perf
@@ -0,0 +1,171 @@
+/*******************************************************************************
+//
+//  SYCL 2020 Conformance Test Suite
+//
+//  Copyright (c) 2026 The Khronos Group Inc.
+//
+//  Licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//
+//  Checks whether sub-buffers and reinterpreted buffers share the storage of
+//  their parent. Writes through a view must be visible through the parent;
+//  pointer identity of host accessors and of use_host_ptr memory is reported.
+//  Creating and accessing views of different sizes of a large buffer is
+//  timed: the time of a zero-copy implementation does not grow with the size
+//  of the view.
+//
+*******************************************************************************/
+
+#include "../common/benchmark.h"
+#include "../common/common.h"
+#include "../common/once_per_unit.h"
+
+namespace buffer_sub_buffer_zero_copy_perf {
+using namespace sycl_cts::util;
+
+/** Upper limit of the parent buffer size, bytes */
+constexpr size_t max_parent_bytes = size_t{256} << 20;
+
+/** Views cover 1 / divisor of the parent */
+constexpr size_t view_divisors[] = {64, 4, 2};
+
+/** Number of timed runs of every view */
+constexpr size_t sample_count = 10;
+
+class touch_kernel;
+
+/**
+ * @brief Submits a kernel writing the first element of \p buf and waits
+ */
+void touch(sycl::queue& queue, sycl::buffer<unsigned, 1>& buf,
+           unsigned value) {
+  queue
+      .submit([&](sycl::handler& cgh) {
+        sycl::accessor acc{buf, cgh, sycl::read_write};
+        cgh.single_task<touch_kernel>([=] { acc[0] = value; });
+      })
+      .wait_and_throw();
+}
+
+/**
+ * @brief Returns the address of the data seen through a host_accessor
+ */
+template <typename T>
+const void* get_host_pointer(sycl::buffer<T, 1>& buf) {
+  sycl::host_accessor acc{buf, sycl::read_only};
+  return acc.get_pointer();
+}
+
+TEST_CASE("Sub-buffers and reinterpreted buffers share storage",
+          "[buffer][perf]") {
+  auto queue = once_per_unit::get_queue();
+  const auto device = queue.get_device();
+  const size_t parent_bytes = std::min<size_t>(
+      max_parent_bytes,
+      device.get_info<sycl::info::device::max_mem_alloc_size>());
+  const size_t count = parent_bytes / sizeof(unsigned);
+  // Offsets of power of two fractions of the parent are aligned to
+  // mem_base_addr_align for any realistic alignment
+  const size_t offset = count / 4;
+
+  std::vector<unsigned> host_data(count);
+  for (size_t i = 0; i < count; ++i) host_data[i] = static_cast<unsigned>(i);
+  sycl::buffer<unsigned, 1> parent{
+      host_data.data(), sycl::range<1>{count},
+      sycl::property_list{sycl::property::buffer::use_host_ptr{}}};
+
+  SECTION("shared storage") {
+    sycl::buffer<unsigned, 1> sub{parent, sycl::id<1>{offset},
+                                  sycl::range<1>{count / 4}};
+    auto bytes = parent.reinterpret<unsigned char>(
+        sycl::range<1>{count * sizeof(unsigned)});
+
+    // Writes through the views must be visible through the parent
+    touch(queue, sub, 0xdeadbeef);
+    {
+      sycl::host_accessor acc{parent, sycl::read_only};
+      CHECK(acc[offset] == 0xdeadbeefu);
+    }
+    {
+      sycl::host_accessor acc{bytes, sycl::write_only};
+      for (size_t i = 0; i < sizeof(unsigned); ++i) acc[i] = 0;
+    }
+    {
+      sycl::host_accessor acc{parent, sycl::read_only};
+      CHECK(acc[0] == 0u);
+    }
+
+    const auto* parent_ptr =
+        static_cast<const unsigned*>(get_host_pointer(parent));
+    const bool parent_is_host_data = parent_ptr == host_data.data();
+    const bool sub_shares = get_host_pointer(sub) == parent_ptr + offset;
+    const bool bytes_share = get_host_pointer(bytes) == parent_ptr;
+    WARN("[perf] host_accessor pointers: parent "
+         << (parent_is_host_data ? "is" : "is not")
+         << " the use_host_ptr memory, sub-buffer "
+         << (sub_shares ? "aliases" : "does not alias")
+         << " the parent, reinterpreted buffer "
+         << (bytes_share ? "aliases" : "does not alias") << " the parent");
+  }
+
+  SECTION("view size scaling") {
+    std::vector<double> create_p50;
+    for (size_t divisor : view_divisors) {
+      const size_t view_count = count / divisor;
+      const std::string size = benchmark::format_bytes(
+          static_cast<double>(view_count * sizeof(unsigned)));
+      INFO("view of " << size);
+      // Data is moved to the device, so a copying view would have to read it
+      touch(queue, parent, 1);
+
+      const auto create = benchmark::measure(sample_count, [&] {
+        sycl::buffer<unsigned, 1> sub{parent, sycl::id<1>{offset},
+                                      sycl::range<1>{view_count}};
+        touch(queue, sub, 2);
+      });
+      benchmark::report("sub-buffer of " + size + ", create and run kernel",
+                        create);
+      create_p50.push_back(create.p50);
+
+      const auto host_access = benchmark::measure(sample_count, [&] {
+        touch(queue, parent, 3);
+        sycl::buffer<unsigned, 1> sub{parent, sycl::id<1>{offset},
+                                      sycl::range<1>{view_count}};
+        sycl::host_accessor acc{sub, sycl::read_only};
+      });
+      benchmark::report("sub-buffer of " + size +
+                            ", parent kernel then host_accessor on view",
+                        host_access);
+    }
+
+    const auto reinterpret = benchmark::measure(sample_count, [&] {
+      touch(queue, parent, 3);
+      auto bytes = parent.reinterpret<unsigned char>(
+          sycl::range<1>{count * sizeof(unsigned)});
+      sycl::host_accessor acc{bytes, sycl::read_only};
+    });
+    benchmark::report(
+        "reinterpret<unsigned char>, parent kernel then host_accessor on view",
+        reinterpret);
+    {
+      sycl::host_accessor acc{parent, sycl::read_only};
+      CHECK(acc[offset] == 2u);
+    }
+    WARN("[perf] sub-buffer creation of the largest view takes "
+         << create_p50.back() / create_p50.front()
+         << "x the time of the smallest one for a "
+         << view_divisors[0] / view_divisors[std::size(view_divisors) - 1]
+         << "x size ratio; values close to 1 indicate zero-copy views");
+  }
+}
+
+}  // namespace buffer_sub_buffer_zero_copy_perf
@@ -0,0 +1,264 @@
+/*******************************************************************************
+//
+//  SYCL 2020 Conformance Test Suite
+//
+//  Copyright (c) 2026 The Khronos Group Inc.
+//
+//  Licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//
+//  Instruments the host side copies of buffers: host_accessor creation and
+//  buffer destruction are timed for buffers using the host pointer storage,
+//  a copy of host data and runtime owned storage, after kernels that read or
+//  write the data. The number of copies is estimated from the time relative
+//  to a host memcpy of the same size, and the amount of memory touched for
+//  the first time from the minor page fault counter. Copies that do not bring
+//  data modified elsewhere to where it is needed are reported as redundant.
+//
+*******************************************************************************/
+
+#include "../common/benchmark.h"
+#include "../common/common.h"
+#include "../common/once_per_unit.h"
+
+#include <cstring>
+#include <optional>
+
+namespace buffer_write_back_perf {
+using namespace sycl_cts::util;
+
+/** Size of every buffer, elements */
+constexpr size_t element_count = size_t{16} << 20;
+
+/** Number of timed runs of every configuration */
+constexpr size_t sample_count = 5;
+
+/** Assumed page size used to convert page faults to bytes */
+constexpr size_t page_size = 4096;
+
+enum class storage_kind { use_host_ptr, host_data_copy, owned };
+enum class kernel_access { read, write_no_init, read_write };
+enum class host_access { none, read, write_no_init };
+
+std::string get_name(storage_kind storage) {
+  switch (storage) {
+    case storage_kind::use_host_ptr:
+      return "use_host_ptr";
+    case storage_kind::host_data_copy:
+      return "host data";
+    default:
+      return "owned storage";
+  }
+}
+
+std::string get_name(kernel_access access) {
+  switch (access) {
+    case kernel_access::read:
+      return "kernel reads";
+    case kernel_access::write_no_init:
+      return "kernel writes with no_init";
+    default:
+      return "kernel read_write";
+  }
+}
+
+std::string get_name(host_access access) {
+  switch (access) {
+    case host_access::none:
+      return "no host_accessor";
+    case host_access::read:
+      return "read host_accessor";
+    default:
+      return "no_init host_accessor";
+  }
+}
+
+/**
+ * @brief Time and newly touched pages of a measured operation
+ */
+struct copy_cost {
+  double ns = 0.0;
+  size_t page_faults = 0;
+};
+
+template <typename ActionT>
+copy_cost instrument(ActionT&& action) {
+  copy_cost cost;
+  const size_t faults_before = benchmark::get_minor_page_faults();
+  cost.ns = benchmark::time_ns(action);
+  cost.page_faults = benchmark::get_minor_page_faults() - faults_before;
+  return cost;
+}
+
+template <kernel_access Access>
+class access_kernel;
+
+template <kernel_access Access>
+void submit_kernel(sycl::queue& queue, sycl::buffer<unsigned, 1>& buf,
+                   sycl::buffer<unsigned, 1>& flag_buf) {
+  const sycl::range<1> range{element_count};
+  queue.submit([&](sycl::handler& cgh) {
+    if constexpr (Access == kernel_access::read) {
+      sycl::accessor acc{buf, cgh, sycl::read_only};
+      sycl::accessor flag{flag_buf, cgh, sycl::write_only};
+      cgh.parallel_for<access_kernel<Access>>(range, [=](sycl::id<1> i) {
+        if (acc[i] != i[0]) flag[0] = 1;
+      });
+    } else if constexpr (Access == kernel_access::write_no_init) {
+      sycl::accessor acc{buf, cgh, sycl::write_only, sycl::no_init};
+      cgh.parallel_for<access_kernel<Access>>(
+          range, [=](sycl::id<1> i) { acc[i] = 3 * i[0] + 1; });
+    } else {
+      sycl::accessor acc{buf, cgh, sycl::read_write};
+      cgh.parallel_for<access_kernel<Access>>(
+          range, [=](sycl::id<1> i) { acc[i] = 3 * acc[i] + 1; });
+    }
+  });
+  queue.wait_and_throw();
+}
+
+/**
+ * @brief Value of element \p i the host data must hold after destruction
+ */
+unsigned expected_value(size_t i, kernel_access kernel, host_access host) {
+  if (host == host_access::write_no_init)
+    return static_cast<unsigned>(5 * i + 2);
+  if (kernel != kernel_access::read) return static_cast<unsigned>(3 * i + 1);
+  return static_cast<unsigned>(i);
+}
+
+template <kernel_access Access>
+void measure_configuration(sycl::queue& queue, storage_kind storage,
+                           host_access host, double memcpy_ns) {
+  const std::string name = get_name(storage) + ", " + get_name(Access) +
+                           ", " + get_name(host);
+  INFO(name);
+  std::vector<unsigned> host_data(element_count);
+  std::vector<double> accessor_ns;
+  std::vector<double> destructor_ns;
+  size_t accessor_faults = 0;
+  size_t destructor_faults = 0;
+  size_t mismatches = 0;
+  unsigned flag = 0;
+
+  for (size_t sample = 0; sample <= sample_count; ++sample) {
+    for (size_t i = 0; i < element_count; ++i)
+      host_data[i] = static_cast<unsigned>(i);
+    sycl::buffer<unsigned, 1> flag_buf{&flag, sycl::range<1>{1}};
+    std::optional<sycl::buffer<unsigned, 1>> buf;
+    const sycl::range<1> range{element_count};
+    if (storage == storage_kind::use_host_ptr)
+      buf.emplace(host_data.data(), range,
+                  sycl::property_list{sycl::property::buffer::use_host_ptr{}});
+    else if (storage == storage_kind::host_data_copy)
+      buf.emplace(host_data.data(), range);
+    else
+      buf.emplace(range);
+    if (storage == storage_kind::owned) {
+      sycl::host_accessor acc{*buf, sycl::write_only, sycl::no_init};
+      for (size_t i = 0; i < element_count; ++i)
+        acc[i] = static_cast<unsigned>(i);
+    }
+    submit_kernel<Access>(queue, *buf, flag_buf);
+
+    copy_cost accessor_cost;
+    if (host == host_access::read) {
+      std::optional<sycl::host_accessor<unsigned, 1, sycl::access_mode::read>>
+          acc;
+      accessor_cost = instrument([&] { acc.emplace(*buf, sycl::read_only); });
+      for (size_t i = 0; i < element_count; ++i)
+        mismatches += (*acc)[i] != expected_value(i, Access, host);
+    } else if (host == host_access::write_no_init) {
+      std::optional<
+          sycl::host_accessor<unsigned, 1, sycl::access_mode::write>>
+          acc;
+      accessor_cost = instrument(
+          [&] { acc.emplace(*buf, sycl::write_only, sycl::no_init); });
+      for (size_t i = 0; i < element_count; ++i)
+        (*acc)[i] = expected_value(i, Access, host);
+    }
+    const copy_cost destructor_cost = instrument([&] { buf.reset(); });
+
+    // The first run is a warm-up
+    if (sample == 0) continue;
+    accessor_ns.push_back(accessor_cost.ns);
+    destructor_ns.push_back(destructor_cost.ns);
+    accessor_faults += accessor_cost.page_faults;
+    destructor_faults += destructor_cost.page_faults;
+    if (storage != storage_kind::owned) {
+      for (size_t i = 0; i < element_count; ++i)
+        mismatches += host_data[i] != expected_value(i, Access, host);
+    }
+  }
+  CHECK(mismatches == 0);
+  CHECK(flag == 0);
+
+  const double bytes = static_cast<double>(element_count * sizeof(unsigned));
+  // A host_accessor only needs a copy of data the kernel wrote. Destruction
+  // only needs to write back to host memory the kernel wrote after the last
+  // host_accessor, which already brought the data to the host; owned storage
+  // has no host memory to write back to. Any other copy is redundant.
+  const bool kernel_wrote = Access != kernel_access::read;
+  const bool write_back_needed = storage != storage_kind::owned &&
+                                 kernel_wrote && host == host_access::none;
+  auto report = [&](const std::string& operation,
+                    const std::vector<double>& samples, size_t faults,
+                    bool copy_needed) {
+    const auto stats = benchmark::get_stats(samples);
+    const double copies = stats.p50 / memcpy_ns;
+    const double touched =
+        static_cast<double>(faults * page_size) / sample_count;
+    WARN("[perf] " << name << ", " << operation << ": "
+                   << benchmark::format_duration(stats.p50) << ", ~"
+                   << copies << " host memcpy of the buffer, "
+                   << benchmark::format_bytes(touched) << " ("
+                   << touched / bytes << "x buffer) newly touched memory"
+                   << (!copy_needed && copies >= 0.5 ? "; redundant copy"
+                                                     : ""));
+  };
+  if (host != host_access::none)
+    report("host_accessor creation", accessor_ns, accessor_faults,
+           kernel_wrote);
+  report("buffer destruction", destructor_ns, destructor_faults,
+         write_back_needed);
+}
+
+TEST_CASE("Host copies at host_accessor creation and buffer destruction",
+          "[buffer][perf]") {
+  auto queue = once_per_unit::get_queue();
+
+  // Reference for a single host side copy of the buffer data
+  std::vector<unsigned> src(element_count, 1);
+  std::vector<unsigned> dst(element_count, 0);
+  const double memcpy_ns =
+      benchmark::measure(sample_count, [&] {
+        std::memcpy(dst.data(), src.data(), element_count * sizeof(unsigned));
+      }).p50;
+  WARN("[perf] host memcpy of "
+       << benchmark::format_bytes(element_count * sizeof(unsigned)) << ": "
+       << benchmark::format_duration(memcpy_ns));
+
+  for (auto storage : {storage_kind::use_host_ptr,
+                       storage_kind::host_data_copy, storage_kind::owned}) {
+    for (auto host :
+         {host_access::none, host_access::read, host_access::write_no_init}) {
+      measure_configuration<kernel_access::read>(queue, storage, host,
+                                                 memcpy_ns);
+      measure_configuration<kernel_access::write_no_init>(queue, storage,
+                                                          host, memcpy_ns);
+      measure_configuration<kernel_access::read_write>(queue, storage, host,
+                                                       memcpy_ns);
+    }
+  }
+}
+
+}  // namespace buffer_write_back_perf
@@ -0,0 +1,282 @@
+/*******************************************************************************
+//
+//  SYCL 2020 Conformance Test Suite
+//
+//  Copyright (c) 2026 The Khronos Group Inc.
+//
+//  Licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//
+//  Provides common timing and reporting helpers for performance tests.
+//  Performance tests live in files named *_perf.cpp (or *_perf_core.cpp,
+//  *_perf_fp16.cpp and *_perf_fp64.cpp) and are only built if
+//  SYCL_CTS_ENABLE_PERFORMANCE_TESTS is enabled. They check the results they
+//  compute, but never fail because of the measured numbers: those are printed
+//  with Catch2's WARN macro so they show up in every reporter.
+//
+*******************************************************************************/
+
+#ifndef __SYCLCTS_TESTS_COMMON_BENCHMARK_H
+#define __SYCLCTS_TESTS_COMMON_BENCHMARK_H
+
+#include <catch2/catch_test_macros.hpp>
+
+#ifdef __linux__
+#include <sys/resource.h>
+#endif
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <fstream>
+#include <iomanip>
+#include <iterator>
+#include <numeric>
+#include <sstream>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace sycl_cts {
+namespace util {
+namespace benchmark {
+
+using clock = std::chrono::steady_clock;
+
+/** Number of timed runs used by default for every measurement */
+constexpr std::size_t default_sample_count = 50;
+
+/**
+ * @brief Summary of a set of timing samples, all durations in nanoseconds
+ */
+struct sample_stats {
+  std::size_t count{};
+  double min{};
+  double mean{};
+  double p50{};
+  double p90{};
+  double p99{};
+  double max{};
+};
+
+/**
+ * @brief Returns the duration between two time points in nanoseconds
+ */
+inline double elapsed_ns(clock::time_point start, clock::time_point end) {
+  return std::chrono::duration<double, std::nano>(end - start).count();
+}
+
+/**
+ * @brief Returns the \p percent percentile of \p sorted_samples using linear
+ *        interpolation between the closest ranks
+ */
+inline double percentile(const std::vector<double>& sorted_samples,
+                         double percent) {
+  if (sorted_samples.empty()) return 0.0;
+  const double rank = percent / 100.0 * (sorted_samples.size() - 1);
+  const std::size_t lower = static_cast<std::size_t>(rank);
+  const std::size_t upper = std::min(lower + 1, sorted_samples.size() - 1);
+  return sorted_samples[lower] +
+         (sorted_samples[upper] - sorted_samples[lower]) * (rank - lower);
+}
+
+/**
+ * @brief Computes the distribution summary of \p samples
+ */
+inline sample_stats get_stats(std::vector<double> samples) {
+  sample_stats stats;
+  stats.count = samples.size();
+  if (samples.empty()) return stats;
+  std::sort(samples.begin(), samples.end());
+  stats.min = samples.front();
+  stats.max = samples.back();
+  stats.mean = std::accumulate(samples.begin(), samples.end(), 0.0) /
+               samples.size();
+  stats.p50 = percentile(samples, 50.0);
+  stats.p90 = percentile(samples, 90.0);
+  stats.p99 = percentile(samples, 99.0);
+  return stats;
+}
+
+/**
+ * @brief Returns the time in nanoseconds taken by a single call of \p action
+ */
+template <typename ActionT>
+double time_ns(ActionT&& action) {
+  const auto start = clock::now();
+  action();
+  return elapsed_ns(start, clock::now());
+}
+
+/**
+ * @brief Calls \p action once to warm up and then \p sample_count times,
+ *        recording the duration of every timed call
+ * @param action Callable that must not return before the measured work has
+ *        completed, e.g. by waiting on the queue
+ */
+template <typename ActionT>
+std::vector<double> sample(std::size_t sample_count, ActionT&& action) {
+  action();
+  std::vector<double> samples;
+  samples.reserve(sample_count);
+  for (std::size_t i = 0; i < sample_count; ++i)
+    samples.push_back(time_ns(action));
+  return samples;
+}
+
+/**
+ * @brief Shortcut for get_stats(sample(sample_count, action))
+ */
+template <typename ActionT>
+sample_stats measure(std::size_t sample_count, ActionT&& action) {
+  return get_stats(sample(sample_count, std::forward<ActionT>(action)));
+}
+
+/**
+ * @brief Formats duration given in nanoseconds using the closest unit
+ */
+inline std::string format_duration(double ns) {
+  std::ostringstream out;
+  out << std::fixed << std::setprecision(2);
+  if (ns >= 1e9)
+    out << ns / 1e9 << " s";
+  else if (ns >= 1e6)
+    out << ns / 1e6 << " ms";
+  else if (ns >= 1e3)
+    out << ns / 1e3 << " us";
+  else
+    out << ns << " ns";
+  return out.str();
+}
+
+/**
+ * @brief Formats rate of \p amount units per \p ns nanoseconds using decimal
+ *        prefixes, e.g. "1.50 GB/s" for unit "B"
+ */
+inline std::string format_rate(double amount, double ns,
+                               const std::string& unit) {
+  std::ostringstream out;
+  out << std::fixed << std::setprecision(2);
+  if (ns <= 0.0) {
+    out << "n/a " << unit << "/s";
+    return out.str();
+  }
+  double rate = amount / (ns * 1e-9);
+  const char* prefixes[] = {"", "K", "M", "G", "T"};
+  std::size_t prefix = 0;
+  while (rate >= 1000.0 && prefix + 1 < std::size(prefixes)) {
+    rate /= 1000.0;
+    ++prefix;
+  }
+  out << rate << " " << prefixes[prefix] << unit << "/s";
+  return out.str();
+}
+
+/**
+ * @brief Reads a memory usage field of /proc/self/status, in bytes
+ * @param field Field name including the colon, e.g. "VmRSS:"
+ * @retval 0 if the value is not available on this platform
+ */
+inline std::size_t read_process_memory(const std::string& field) {
+#ifdef __linux__
+  std::ifstream status("/proc/self/status");
+  std::string line;
+  while (std::getline(status, line)) {
+    if (line.compare(0, field.size(), field) != 0) continue;
+    std::istringstream value(line.substr(field.size()));
+    std::size_t kib = 0;
+    value >> kib;
+    return kib * 1024;
+  }
+#else
+  static_cast<void>(field);
+#endif
+  return 0;
+}
+
+/**
+ * @brief Returns resident set size of the process in bytes, 0 if unknown
+ */
+inline std::size_t get_current_rss() { return read_process_memory("VmRSS:"); }
+
+/**
+ * @brief Returns peak resident set size of the process in bytes, 0 if unknown
+ */
+inline std::size_t get_peak_rss() { return read_process_memory("VmHWM:"); }
+
+/**
+ * @brief Returns the number of minor page faults of the process so far, i.e.
+ *        first touches of pages not backed by physical memory yet
+ * @retval 0 if the value is not available on this platform
+ */
+inline std::size_t get_minor_page_faults() {
+#ifdef __linux__
+  rusage usage{};
+  if (getrusage(RUSAGE_SELF, &usage) == 0)
+    return static_cast<std::size_t>(usage.ru_minflt);
+#endif
+  return 0;
+}
+
+/**
+ * @brief Formats memory size given in bytes using binary prefixes
+ */
+inline std::string format_bytes(double bytes) {
+  std::ostringstream out;
+  out << std::fixed << std::setprecision(2);
+  const char* prefixes[] = {"", "Ki", "Mi", "Gi", "Ti"};
+  std::size_t prefix = 0;
+  while ((bytes >= 1024.0 || bytes <= -1024.0) &&
+         prefix + 1 < std::size(prefixes)) {
+    bytes /= 1024.0;
+    ++prefix;
+  }
+  out << bytes << " " << prefixes[prefix] << "B";
+  return out.str();
+}
+
+/**
+ * @brief Formats the distribution summary as a single line
+ */
+inline std::string format_stats(const sample_stats& stats) {
+  std::ostringstream out;
+  out << "n=" << stats.count << " min=" << format_duration(stats.min)
+      << " p50=" << format_duration(stats.p50)
+      << " p90=" << format_duration(stats.p90)
+      << " p99=" << format_duration(stats.p99)
+      << " max=" << format_duration(stats.max)
+      << " mean=" << format_duration(stats.mean);
+  return out.str();
+}
+
+/**
+ * @brief Prints timing distribution of the \p name measurement
+ */
+inline void report(const std::string& name, const sample_stats& stats) {
+  WARN("[perf] " << name << ": " << format_stats(stats));
+}
+
+/**
+ * @brief Prints timing distribution of the \p name measurement together with
+ *        the median throughput of processing \p amount units per sample
+ */
+inline void report(const std::string& name, const sample_stats& stats,
+                   double amount, const std::string& unit) {
+  WARN("[perf] " << name << ": " << format_rate(amount, stats.p50, unit)
+                 << " (" << format_stats(stats) << ")");
+}
+
+}  // namespace benchmark
+}  // namespace util
+}  // namespace sycl_cts
+
+#endif  // __SYCLCTS_TESTS_COMMON_BENCHMARK_H
@@ -0,0 +1,84 @@
+/*******************************************************************************
+//
+//  SYCL 2020 Conformance Test Suite
+//
+//  Copyright (c) 2026 The Khronos Group Inc.
+//
+//  Licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//
+//  Provides helpers measuring the overhead of submitting commands to a queue.
+//
+*******************************************************************************/
+
+#ifndef __SYCLCTS_TESTS_COMMON_SUBMISSION_BENCHMARK_H
+#define __SYCLCTS_TESTS_COMMON_SUBMISSION_BENCHMARK_H
+
+#include "benchmark.h"
+#include "common.h"
+
+#include <string>
+#include <vector>
+
+namespace sycl_cts {
+namespace util {
+namespace benchmark {
+
+/** Number of submit and wait round trips timed for every API */
+constexpr std::size_t round_trip_samples = 1000;
+
+/** Number of submissions issued back to back before a single wait */
+constexpr std::size_t pipelined_submissions = 10000;
+
+/**
+ * @brief Returns a queue on the device used by the CTS with the given
+ *        properties
+ */
+inline sycl::queue make_queue(const sycl::property_list& properties) {
+  return sycl::queue(get_cts_object::device(), properties);
+}
+
+/**
+ * @brief Measures the submit to completion round trip of a single command and
+ *        the submission rate when commands are issued back to back
+ * @param submit Callable submitting a single command to \p queue. Completion
+ *        is detected with queue::wait(), so the returned event is not used
+ *        and queues with discarded events are supported.
+ */
+template <typename SubmitT>
+void measure_submission(sycl::queue& queue, const std::string& name,
+                        SubmitT&& submit) {
+  INFO(name);
+  const auto round_trip = measure(round_trip_samples, [&] {
+    submit();
+    queue.wait_and_throw();
+  });
+  report(name + ", submit and wait", round_trip);
+
+  std::vector<double> submit_ns;
+  submit_ns.reserve(pipelined_submissions);
+  const double total_ns = time_ns([&] {
+    for (std::size_t i = 0; i < pipelined_submissions; ++i)
+      submit_ns.push_back(time_ns(submit));
+    queue.wait_and_throw();
+  });
+  report(name + ", pipelined submit call", get_stats(submit_ns));
+  WARN("[perf] " << name << ", pipelined: "
+                 << format_rate(pipelined_submissions, total_ns, "commands")
+                 << " including the final wait");
+}
+
+}  // namespace benchmark
+}  // namespace util
+}  // namespace sycl_cts
+
+#endif  // __SYCLCTS_TESTS_COMMON_SUBMISSION_BENCHMARK_H
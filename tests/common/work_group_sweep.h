@@ -0,0 +1,206 @@
+/*******************************************************************************
+//
+//  SYCL 2020 Conformance Test Suite
+//
+//  Copyright (c) 2026 The Khronos Group Inc.
+//
+//  Licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//
+*******************************************************************************/
+
+#ifndef __SYCLCTS_TESTS_COMMON_WORK_GROUP_SWEEP_H
+#define __SYCLCTS_TESTS_COMMON_WORK_GROUP_SWEEP_H
+
+#include "benchmark.h"
+#include "common.h"
+#include "get_group_range.h"
+
+#include <limits>
+#include <string>
+#include <vector>
+
+namespace sycl_cts {
+namespace util {
+
+/**
+ * Work-group size limit of the sweep when the limit of the kernel cannot be
+ * queried; small enough for kernels with high register pressure
+ */
+constexpr size_t conservative_work_group_size = 64;
+
+/**
+ * @brief Timing of a kernel for a single work-group range
+ * @tparam Dimensions Dimension of the work-group range
+ */
+template <int Dimensions>
+struct work_group_sweep_entry {
+  sycl::range<Dimensions> local_range;
+  benchmark::sample_stats stats;
+};
+
+/**
+ * @brief Per-device tuning table of a kernel together with the fastest
+ *        work-group range found
+ * @tparam Dimensions Dimension of the work-group range
+ */
+template <int Dimensions>
+struct work_group_sweep_result {
+  sycl::range<Dimensions> best_local_range = get_default_range<Dimensions>();
+  std::vector<work_group_sweep_entry<Dimensions>> table;
+};
+
+/**
+ * @brief Returns sycl::info::device::max_work_item_sizes for three dimensions
+ */
+inline sycl::id<3> get_max_work_item_sizes(const sycl::device& device) {
+  // FIXME: hipSYCL does not implement
+  //        sycl::info::device::max_work_item_sizes<3> property
+#if SYCL_CTS_COMPILING_WITH_HIPSYCL
+  return device.get_info<sycl::info::device::max_work_item_sizes>();
+#else
+  return device.get_info<sycl::info::device::max_work_item_sizes<3>>();
+#endif
+}
+
+/**
+ * @brief Enumerates work-group ranges that are legal for \p device and evenly
+ *        divide \p global_range. Every dimension is a power of two or the
+ *        range given by work_group_range(), so the default configuration is
+ *        always part of the sweep if it divides \p global_range.
+ * @tparam Dimensions Dimension of the work-group range
+ * @param work_items_limit Additional limit for the work-group size
+ */
+template <int Dimensions>
+std::vector<sycl::range<Dimensions>> get_work_group_ranges(
+    const sycl::queue& queue, const sycl::range<Dimensions>& global_range,
+    size_t work_items_limit = std::numeric_limits<size_t>::max()) {
+  const auto device = queue.get_device();
+  const sycl::id<3> max_work_item_sizes = get_max_work_item_sizes(device);
+  const size_t max_work_group_size = std::min(
+      device.get_info<sycl::info::device::max_work_group_size>(),
+      work_items_limit);
+  const auto default_range =
+      work_group_range<Dimensions>(queue, max_work_group_size);
+
+  std::vector<size_t> candidates[Dimensions];
+  for (int i = 0; i < Dimensions; ++i) {
+    const size_t limit = std::min(max_work_item_sizes[i], max_work_group_size);
+    for (size_t size = 1; size <= limit; size *= 2) {
+      if (global_range[i] % size == 0) candidates[i].push_back(size);
+    }
+    const size_t default_size = default_range[i];
+    if (global_range[i] % default_size == 0 &&
+        std::find(candidates[i].begin(), candidates[i].end(), default_size) ==
+            candidates[i].end())
+      candidates[i].push_back(default_size);
+  }
+
+  std::vector<sycl::range<Dimensions>> result;
+  sycl::range<Dimensions> current = get_default_range<Dimensions>();
+  // Cartesian product of the candidates, pruned by the work-group size limit
+  auto enumerate = [&](auto& self, int dim, size_t size) -> void {
+    if (dim == Dimensions) {
+      result.push_back(current);
+      return;
+    }
+    for (size_t candidate : candidates[dim]) {
+      if (size * candidate > max_work_group_size) continue;
+      current[dim] = candidate;
+      self(self, dim + 1, size * candidate);
+    }
+  };
+  enumerate(enumerate, 0, 1);
+  return result;
+}
+
+/**
+ * @brief Returns the largest work-group size the kernel \p KernelName
+ *        supports on the device of \p queue, or conservative_work_group_size
+ *        if the kernel is not available in an executable kernel bundle
+ */
+template <typename KernelName>
+size_t get_kernel_work_group_limit(const sycl::queue& queue) {
+  const auto device = queue.get_device();
+// hipSYCL does not yet support sycl::get_kernel_bundle
+#if !SYCL_CTS_COMPILING_WITH_HIPSYCL
+  const auto context = queue.get_context();
+  const std::vector<sycl::device> devices{device};
+  if (sycl::has_kernel_bundle<KernelName, sycl::bundle_state::executable>(
+          context, devices)) {
+    auto bundle =
+        sycl::get_kernel_bundle<KernelName, sycl::bundle_state::executable>(
+            context, devices);
+    const auto kernel = bundle.get_kernel(sycl::get_kernel_id<KernelName>());
+    return kernel.template get_info<
+        sycl::info::kernel_device_specific::work_group_size>(device);
+  }
+#endif
+  return std::min(conservative_work_group_size,
+                  device.get_info<sycl::info::device::max_work_group_size>());
+}
+
+/**
+ * @brief Times a kernel for every work-group range returned by
+ *        get_work_group_ranges() and returns the per-device tuning table
+ * @tparam KernelName Name of the kernel submitted by \p run, used to limit
+ *         the work-group size by get_kernel_work_group_limit()
+ * @tparam Dimensions Dimension of the nd_range
+ * @param run Callable taking sycl::nd_range<Dimensions> that submits the
+ *        kernel and waits for its completion
+ */
+template <typename KernelName, int Dimensions, typename RunT>
+work_group_sweep_result<Dimensions> sweep_work_group_size(
+    sycl::queue& queue, const sycl::range<Dimensions>& global_range, RunT&& run,
+    size_t sample_count = benchmark::default_sample_count) {
+  const size_t kernel_limit = get_kernel_work_group_limit<KernelName>(queue);
+
+  work_group_sweep_result<Dimensions> result;
+  for (const auto& local_range :
+       get_work_group_ranges(queue, global_range, kernel_limit)) {
+    const sycl::nd_range<Dimensions> range{global_range, local_range};
+    result.table.push_back(
+        {local_range, benchmark::measure(sample_count, [&] { run(range); })});
+  }
+
+  const auto best = std::min_element(
+      result.table.begin(), result.table.end(),
+      [](const auto& lhs, const auto& rhs) {
+        return lhs.stats.p50 < rhs.stats.p50;
+      });
+  if (best != result.table.end()) result.best_local_range = best->local_range;
+  return result;
+}
+
+/**
+ * @brief Prints the tuning table one entry per line, so it can be extracted
+ *        from the test output by the "[perf] tuning" prefix
+ */
+template <int Dimensions>
+void report_work_group_sweep(
+    const sycl::queue& queue, const std::string& kernel_description,
+    const work_group_sweep_result<Dimensions>& result) {
+  const std::string device_name =
+      queue.get_device().get_info<sycl::info::device::name>();
+  for (const auto& entry : result.table) {
+    const bool is_best = entry.local_range == result.best_local_range;
+    WARN("[perf] tuning; " << device_name << "; " << kernel_description << "; "
+                           << work_group_print(entry.local_range) << "; "
+                           << benchmark::format_stats(entry.stats)
+                           << (is_best ? "; best" : ""));
+  }
+}
+
+}  // namespace util
+}  // namespace sycl_cts
+
+#endif  // __SYCLCTS_TESTS_COMMON_WORK_GROUP_SWEEP_H
@@ -0,0 +1,172 @@
+/*******************************************************************************
+//
+//  SYCL 2020 Conformance Test Suite
+//
+//  Copyright (c) 2026 The Khronos Group Inc.
+//
+//  Licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//
+//  Stress test for the event dependency tracking of the runtime. Builds large
+//  graphs of command groups connected with handler::depends_on(): chains,
+//  fan-out, fan-in and random DAGs of up to 100k nodes. Every command takes a
+//  ticket from a global atomic counter, which serves as a logical timestamp
+//  of its execution; the test verifies that every command ran after all of
+//  its dependencies and reports the scheduling throughput and memory growth.
+//
+*******************************************************************************/
+
+#include "../common/benchmark.h"
+#include "../common/common.h"
+#include "../common/once_per_unit.h"
+
+#include <random>
+
+namespace event_dag_perf {
+using namespace sycl_cts::util;
+
+/** Graph sizes, the ratio between neighbours shows the scaling behavior */
+constexpr size_t node_counts[] = {1000, 10000, 100000};
+
+/** Maximum number of dependencies of a node of a random DAG */
+constexpr size_t max_random_parents = 4;
+
+enum class dag_shape { chain, fan_out, fan_in, random };
+
+std::string get_shape_name(dag_shape shape) {
+  switch (shape) {
+    case dag_shape::chain:
+      return "chain";
+    case dag_shape::fan_out:
+      return "fan-out";
+    case dag_shape::fan_in:
+      return "fan-in";
+    default:
+      return "random DAG";
+  }
+}
+
+/**
+ * @brief Returns the list of dependencies of every node. Nodes only depend on
+ *        nodes with smaller indices, so the submission order is topological.
+ */
+std::vector<std::vector<size_t>> make_graph(dag_shape shape, size_t nodes) {
+  std::vector<std::vector<size_t>> parents(nodes);
+  std::mt19937 gen(static_cast<unsigned>(nodes));
+  for (size_t node = 1; node < nodes; ++node) {
+    switch (shape) {
+      case dag_shape::chain:
+        parents[node].push_back(node - 1);
+        break;
+      case dag_shape::fan_out:
+        parents[node].push_back(0);
+        break;
+      case dag_shape::fan_in:
+        // Every node but the last one is independent
+        if (node == nodes - 1)
+          for (size_t parent = 0; parent < node; ++parent)
+            parents[node].push_back(parent);
+        break;
+      default: {
+        std::uniform_int_distribution<size_t> count(
+            0, std::min(node, max_random_parents));
+        std::uniform_int_distribution<size_t> parent(0, node - 1);
+        for (size_t i = count(gen); i > 0; --i)
+          parents[node].push_back(parent(gen));
+        break;
+      }
+    }
+  }
+  return parents;
+}
+
+class dag_node_kernel;
+
+void run_graph(sycl::queue& queue, dag_shape shape, size_t nodes) {
+  const auto parents = make_graph(shape, nodes);
+  size_t edges = 0;
+  for (const auto& node_parents : parents) edges += node_parents.size();
+  const std::string name = get_shape_name(shape) + " of " +
+                           std::to_string(nodes) + " nodes, " +
+                           std::to_string(edges) + " edges";
+  INFO(name);
+
+  int* counter = sycl::malloc_device<int>(1, queue);
+  int* order = sycl::malloc_device<int>(nodes, queue);
+  REQUIRE(counter != nullptr);
+  REQUIRE(order != nullptr);
+  queue.fill(counter, 0, 1).wait_and_throw();
+  queue.fill(order, -1, nodes).wait_and_throw();
+
+  std::vector<sycl::event> events(nodes);
+  std::vector<sycl::event> dependencies;
+  const size_t rss_before = benchmark::get_current_rss();
+  const double submit_ns = benchmark::time_ns([&] {
+    for (size_t node = 0; node < nodes; ++node) {
+      dependencies.clear();
+      for (size_t parent : parents[node])
+        dependencies.push_back(events[parent]);
+      events[node] = queue.submit([&](sycl::handler& cgh) {
+        cgh.depends_on(dependencies);
+        cgh.single_task<dag_node_kernel>([=] {
+          sycl::atomic_ref<int, sycl::memory_order::relaxed,
+                           sycl::memory_scope::device,
+                           sycl::access::address_space::global_space>
+              ticket(*counter);
+          order[node] = ticket.fetch_add(1);
+        });
+      });
+    }
+  });
+  const size_t rss_submitted = benchmark::get_current_rss();
+  const double wait_ns = benchmark::time_ns([&] { queue.wait_and_throw(); });
+
+  std::vector<int> result(nodes);
+  queue.copy(order, result.data(), nodes).wait_and_throw();
+  sycl::free(order, queue);
+  sycl::free(counter, queue);
+
+  size_t not_run = 0;
+  size_t violations = 0;
+  for (size_t node = 0; node < nodes; ++node) {
+    not_run += result[node] < 0;
+    for (size_t parent : parents[node])
+      violations += result[parent] >= result[node];
+  }
+  CHECK(not_run == 0);
+  CHECK(violations == 0);
+
+  WARN("[perf] " << name << ": submission "
+                 << benchmark::format_rate(nodes, submit_ns, "nodes") << " ("
+                 << benchmark::format_duration(submit_ns / nodes)
+                 << " per node), end to end "
+                 << benchmark::format_rate(nodes, submit_ns + wait_ns,
+                                           "nodes")
+                 << ", RSS growth while in flight "
+                 << benchmark::format_bytes(
+                        static_cast<double>(rss_submitted) -
+                        static_cast<double>(rss_before)));
+}
+
+TEST_CASE("Scheduling of large event dependency graphs", "[event][perf]") {
+  auto queue = once_per_unit::get_queue();
+  if (!queue.get_device().has(sycl::aspect::usm_device_allocations)) {
+    SKIP("Device does not support USM device allocations");
+  }
+
+  for (auto shape : {dag_shape::chain, dag_shape::fan_out, dag_shape::fan_in,
+                     dag_shape::random}) {
+    for (size_t nodes : node_counts) run_graph(queue, shape, nodes);
+  }
+}
+
+}  // namespace event_dag_perf
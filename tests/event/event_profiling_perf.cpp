@@ -0,0 +1,240 @@
+/*******************************************************************************
+//
+//  SYCL 2020 Conformance Test Suite
+//
+//  Copyright (c) 2026 The Khronos Group Inc.
+//
+//  Licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//
+//  Compares event profiling timestamps with the host steady clock. Kernels of
+//  increasing duration are timed with both clocks: the profiled duration can
+//  never exceed the time observed on the host between submission and the end
+//  of the wait, and for long kernels it must be of the same order. The test
+//  also reports the timestamp resolution, the drift of command_submit against
+//  the host clock and the overhead profiling adds to submission.
+//
+*******************************************************************************/
+
+#include "../common/benchmark.h"
+#include "../common/common.h"
+
+#include <cstdint>
+#include <thread>
+
+namespace event_profiling_perf {
+using namespace sycl_cts::util;
+
+/** Number of runs of every kernel duration */
+constexpr size_t duration_samples = 5;
+
+/** Kernels are made longer until they take this long on the host, ns */
+constexpr double max_kernel_ns = 200e6;
+
+/** Upper limit of the generator steps of a kernel */
+constexpr uint64_t max_iterations = uint64_t{1} << 36;
+
+/** Minimum host duration of kernels checked for comparable durations, ns */
+constexpr double long_kernel_ns = 10e6;
+
+/** Number of kernels submitted to estimate the drift of command_submit */
+constexpr size_t drift_kernels = 20;
+
+/** Host delay between the kernels used to estimate the drift */
+constexpr auto drift_delay = std::chrono::milliseconds(5);
+
+/** Number of kernels used to estimate the timestamp resolution */
+constexpr size_t resolution_kernels = 1000;
+
+/** Number of round trips timed to estimate the profiling overhead */
+constexpr size_t overhead_samples = 1000;
+
+class busy_kernel;
+
+/**
+ * @brief Submits a single_task running \p iterations steps of a generator
+ */
+sycl::event run_busy_kernel(sycl::queue& queue, sycl::buffer<unsigned, 1>& buf,
+                            uint64_t iterations) {
+  return queue.submit([&](sycl::handler& cgh) {
+    sycl::accessor acc{buf, cgh, sycl::write_only, sycl::no_init};
+    cgh.single_task<busy_kernel>([=] {
+      unsigned value = 1;
+      for (uint64_t i = 0; i < iterations; ++i)
+        value = value * 1664525u + 1013904223u;
+      acc[0] = value;
+    });
+  });
+}
+
+struct profiled_run {
+  double host_ns;
+  uint64_t submit;
+  uint64_t start;
+  uint64_t end;
+};
+
+profiled_run get_profile(sycl::queue& queue, sycl::buffer<unsigned, 1>& buf,
+                         uint64_t iterations) {
+  profiled_run run{};
+  sycl::event event;
+  run.host_ns = benchmark::time_ns([&] {
+    event = run_busy_kernel(queue, buf, iterations);
+    event.wait_and_throw();
+  });
+  run.submit =
+      event.get_profiling_info<sycl::info::event_profiling::command_submit>();
+  run.start =
+      event.get_profiling_info<sycl::info::event_profiling::command_start>();
+  run.end =
+      event.get_profiling_info<sycl::info::event_profiling::command_end>();
+  return run;
+}
+
+TEST_CASE("Event profiling accuracy against the host clock",
+          "[event][perf]") {
+  const auto device = get_cts_object::device();
+  if (!device.has(sycl::aspect::queue_profiling)) {
+    WARN(
+        "Skipping test because device does not have "
+        "sycl::aspect::queue_profiling");
+    return;
+  }
+  sycl::queue queue(device, {sycl::property::queue::enable_profiling()});
+  sycl::buffer<unsigned, 1> buf{sycl::range<1>{1}};
+
+  SECTION("kernel duration") {
+    double previous_host = 0.0;
+    double previous_device = 0.0;
+    for (uint64_t iterations = 1024; iterations <= max_iterations;
+         iterations *= 4) {
+      std::vector<double> host_ns;
+      std::vector<double> device_ns;
+      for (size_t i = 0; i < duration_samples; ++i) {
+        const auto run = get_profile(queue, buf, iterations);
+        CHECK(run.submit <= run.start);
+        CHECK(run.start <= run.end);
+        host_ns.push_back(run.host_ns);
+        device_ns.push_back(static_cast<double>(run.end - run.start));
+      }
+      const auto host = benchmark::get_stats(host_ns);
+      const auto profiled = benchmark::get_stats(device_ns);
+      INFO("iterations: " << iterations << ", host "
+                          << benchmark::format_duration(host.p50)
+                          << ", profiled "
+                          << benchmark::format_duration(profiled.p50));
+      // The kernel runs between the submission and the end of the wait, so
+      // only the clock rate can make the profiled duration longer
+      CHECK(profiled.p50 <= host.p50 * 1.05 + 1e3);
+      if (host.p50 >= long_kernel_ns) CHECK(profiled.p50 >= 0.5 * host.p50);
+      WARN("[perf] busy kernel of " << iterations << " iterations: host "
+                                    << benchmark::format_duration(host.p50)
+                                    << ", profiled "
+                                    << benchmark::format_duration(profiled.p50)
+                                    << ", profiled / host = "
+                                    << profiled.p50 / host.p50);
+
+      if (host.p50 >= max_kernel_ns || iterations * 4 > max_iterations) {
+        // Submission overhead cancels out in the difference of two runs
+        const double slope = (profiled.p50 - previous_device) /
+                             (host.p50 - previous_host);
+        WARN("[perf] profiled duration grows " << slope
+                                               << "x as fast as host time, "
+                                               << (slope - 1.0) * 1e6
+                                               << " ppm");
+        break;
+      }
+      previous_host = host.p50;
+      previous_device = profiled.p50;
+    }
+  }
+
+  SECTION("command_submit drift") {
+    std::vector<benchmark::clock::time_point> host_times;
+    std::vector<sycl::event> events;
+    for (size_t i = 0; i < drift_kernels; ++i) {
+      host_times.push_back(benchmark::clock::now());
+      events.push_back(run_busy_kernel(queue, buf, 1));
+      std::this_thread::sleep_for(drift_delay);
+    }
+    sycl::event::wait_and_throw(events);
+
+    auto submit_time = [&](size_t i) {
+      return events[i]
+          .get_profiling_info<sycl::info::event_profiling::command_submit>();
+    };
+    const double host_span =
+        benchmark::elapsed_ns(host_times.front(), host_times.back());
+    const double device_span =
+        static_cast<double>(submit_time(drift_kernels - 1) - submit_time(0));
+    const double ratio = device_span / host_span;
+    CHECK(ratio >= 0.5);
+    CHECK(ratio <= 2.0);
+    WARN("[perf] command_submit span "
+         << benchmark::format_duration(device_span) << " vs host span "
+         << benchmark::format_duration(host_span) << ", drift "
+         << (ratio - 1.0) * 1e6 << " ppm");
+  }
+
+  SECTION("timestamp resolution") {
+    std::vector<uint64_t> timestamps;
+    size_t zero_durations = 0;
+    for (size_t i = 0; i < resolution_kernels; ++i) {
+      const auto run = get_profile(queue, buf, 1);
+      timestamps.insert(timestamps.end(), {run.submit, run.start, run.end});
+      zero_durations += run.start == run.end;
+    }
+    std::sort(timestamps.begin(), timestamps.end());
+    uint64_t resolution = 0;
+    for (size_t i = 1; i < timestamps.size(); ++i) {
+      const uint64_t step = timestamps[i] - timestamps[i - 1];
+      if (step != 0 && (resolution == 0 || step < resolution))
+        resolution = step;
+    }
+    WARN("[perf] smallest timestamp step "
+         << benchmark::format_duration(static_cast<double>(resolution))
+         << ", " << zero_durations << " of " << resolution_kernels
+         << " minimal kernels have zero profiled duration");
+  }
+
+  SECTION("profiling overhead") {
+    sycl::queue plain_queue(device);
+    sycl::buffer<unsigned, 1> plain_buf{sycl::range<1>{1}};
+    auto round_trip = [&](sycl::queue& q, sycl::buffer<unsigned, 1>& b) {
+      return benchmark::measure(overhead_samples, [&] {
+        run_busy_kernel(q, b, 1).wait_and_throw();
+      });
+    };
+    const auto plain = round_trip(plain_queue, plain_buf);
+    const auto profiled = round_trip(queue, buf);
+    benchmark::report("submit and wait, no profiling", plain);
+    benchmark::report("submit and wait, enable_profiling", profiled);
+    WARN("[perf] enable_profiling overhead per command "
+         << benchmark::format_duration(profiled.p50 - plain.p50) << " ("
+         << profiled.p50 / plain.p50 << "x)");
+
+    auto event = run_busy_kernel(queue, buf, 1);
+    event.wait_and_throw();
+    benchmark::report(
+        "get_profiling_info of submit, start and end",
+        benchmark::measure(overhead_samples, [&] {
+          static_cast<void>(event.get_profiling_info<
+                            sycl::info::event_profiling::command_submit>());
+          static_cast<void>(event.get_profiling_info<
+                            sycl::info::event_profiling::command_start>());
+          static_cast<void>(event.get_profiling_info<
+                            sycl::info::event_profiling::command_end>());
+        }));
+  }
+}
+
+}  // namespace event_profiling_perf
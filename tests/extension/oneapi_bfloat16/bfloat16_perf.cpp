@@ -0,0 +1,377 @@
+/*******************************************************************************
+//
+//  SYCL 2020 Conformance Test Suite
+//
+//  Copyright (c) 2026 The Khronos Group Inc.
+//
+//  Licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//
+//  Measures the throughput of converting large float arrays to bfloat16 and
+//  back, and of elementwise arithmetic and dot products on bfloat16 compared
+//  with float. Every output element is verified on the host: conversions bit
+//  exactly against round to nearest even, multiplication bit exactly as the
+//  product of two bfloat16 values is exact in float, and addition and dot
+//  products against a double precision reference.
+//
+*******************************************************************************/
+
+#include "../../common/benchmark.h"
+#include "../../common/common.h"
+
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <random>
+
+namespace bfloat16_perf {
+using namespace sycl_cts::util;
+using bfloat16 = sycl::ext::oneapi::bfloat16;
+
+/** Number of elements of the converted and elementwise arrays */
+constexpr size_t element_count = size_t{1} << 22;
+
+/** Number of elements of every dot product */
+constexpr size_t dot_length = 256;
+
+/** Number of dot products computed, one per work item */
+constexpr size_t dot_count = element_count / dot_length;
+
+/** Number of timed runs of every kernel */
+constexpr size_t sample_count = 20;
+
+/**
+ * @brief Returns the bits of \p value rounded to bfloat16 to nearest even;
+ *        \p value must not be NaN
+ */
+std::uint16_t round_to_bfloat16_bits(float value) {
+  const auto bits = sycl::bit_cast<std::uint32_t>(value);
+  const std::uint32_t lsb = (bits >> 16) & 1;
+  return static_cast<std::uint16_t>((bits + 0x7fff + lsb) >> 16);
+}
+
+inline bool is_nan_bits(std::uint16_t bits) {
+  return (bits & 0x7f80) == 0x7f80 && (bits & 0x007f) != 0;
+}
+
+inline bfloat16 from_bits(std::uint16_t bits) {
+  return sycl::bit_cast<bfloat16>(bits);
+}
+
+inline std::uint16_t to_bits(bfloat16 value) {
+  return sycl::bit_cast<std::uint16_t>(value);
+}
+
+/**
+ * @brief Returns floats covering special values, ties and values next to
+ *        ties. Subnormal inputs are replaced with zeros, as devices may flush
+ *        them, which is not a property of the conversion.
+ */
+std::vector<float> make_conversion_input() {
+  std::vector<float> values = {0.f,
+                               -0.f,
+                               1.f,
+                               std::numeric_limits<float>::infinity(),
+                               -std::numeric_limits<float>::infinity(),
+                               std::numeric_limits<float>::quiet_NaN(),
+                               std::numeric_limits<float>::max(),
+                               std::numeric_limits<float>::lowest(),
+                               std::numeric_limits<float>::min()};
+  std::mt19937 generator;
+  while (values.size() < element_count) {
+    std::uint32_t bits = generator();
+    switch (values.size() % 4) {
+      case 0:
+        // Exact tie between two bfloat16 values
+        bits = (bits & 0xffff0000u) | 0x8000u;
+        break;
+      case 1:
+        // Next to a tie
+        bits = (bits & 0xffff0000u) | ((bits & 1) ? 0x8001u : 0x7fffu);
+        break;
+      default:
+        break;
+    }
+    if ((bits & 0x7f800000u) == 0) bits &= 0x80000000u;
+    values.push_back(sycl::bit_cast<float>(bits));
+  }
+  return values;
+}
+
+/**
+ * @brief Returns bfloat16 values with magnitudes in [0.5, 4) and random signs,
+ *        so arithmetic neither overflows nor produces subnormals
+ */
+std::vector<bfloat16> make_arithmetic_input(unsigned seed) {
+  std::mt19937 generator(seed);
+  std::uniform_real_distribution<float> magnitude(0.5f, 4.f);
+  std::vector<bfloat16> values(element_count);
+  for (auto& value : values) {
+    const float sign = (generator() & 1) ? -1.f : 1.f;
+    value = from_bits(round_to_bfloat16_bits(sign * magnitude(generator)));
+  }
+  return values;
+}
+
+void report(const std::string& name, const benchmark::sample_stats& stats) {
+  benchmark::report(name, stats, static_cast<double>(element_count),
+                    "elements");
+}
+
+void report_ratio(const std::string& name, const benchmark::sample_stats& bf16,
+                  const benchmark::sample_stats& fp32) {
+  WARN("[perf] " << name << ": bfloat16 is " << fp32.p50 / bf16.p50
+                 << "x as fast as float");
+}
+
+/**
+ * @brief Times \p sample_count runs of a kernel computing
+ *        out[i] = op(in0[i], in1[i])
+ */
+template <typename KernelT, typename InT, typename OutT, typename OpT>
+benchmark::sample_stats measure_elementwise(sycl::queue& queue,
+                                            sycl::buffer<InT, 1>& in0,
+                                            sycl::buffer<InT, 1>& in1,
+                                            sycl::buffer<OutT, 1>& out,
+                                            OpT op) {
+  return benchmark::measure(sample_count, [&] {
+    queue.submit([&](sycl::handler& cgh) {
+      sycl::accessor a{in0, cgh, sycl::read_only};
+      sycl::accessor b{in1, cgh, sycl::read_only};
+      sycl::accessor c{out, cgh, sycl::write_only, sycl::no_init};
+      cgh.parallel_for<KernelT>(out.get_range(),
+                                [=](sycl::id<1> i) { c[i] = op(a[i], b[i]); });
+    });
+    queue.wait_and_throw();
+  });
+}
+
+/**
+ * @brief Times \p sample_count runs of a kernel computing dot products of
+ *        rows of dot_length elements, accumulating in float
+ */
+template <typename KernelT, typename InT>
+benchmark::sample_stats measure_dot(sycl::queue& queue,
+                                    sycl::buffer<InT, 1>& in0,
+                                    sycl::buffer<InT, 1>& in1,
+                                    sycl::buffer<float, 1>& out) {
+  return benchmark::measure(sample_count, [&] {
+    queue.submit([&](sycl::handler& cgh) {
+      sycl::accessor a{in0, cgh, sycl::read_only};
+      sycl::accessor b{in1, cgh, sycl::read_only};
+      sycl::accessor c{out, cgh, sycl::write_only, sycl::no_init};
+      cgh.parallel_for<KernelT>(sycl::range<1>{dot_count},
+                                [=](sycl::id<1> row) {
+                                  float sum = 0.f;
+                                  const size_t first = row[0] * dot_length;
+                                  for (size_t k = 0; k < dot_length; ++k) {
+                                    sum += static_cast<float>(a[first + k]) *
+                                           static_cast<float>(b[first + k]);
+                                  }
+                                  c[row] = sum;
+                                });
+    });
+    queue.wait_and_throw();
+  });
+}
+
+/**
+ * @brief Returns the number of dot products of \p out further from the
+ *        double precision result than the float accumulation error bound
+ */
+template <typename InT>
+size_t count_wrong_dots(const std::vector<InT>& a, const std::vector<InT>& b,
+                        sycl::buffer<float, 1>& out) {
+  sycl::host_accessor acc{out, sycl::read_only};
+  size_t wrong = 0;
+  for (size_t row = 0; row < dot_count; ++row) {
+    double exact = 0.0;
+    double magnitude = 0.0;
+    for (size_t k = row * dot_length; k < (row + 1) * dot_length; ++k) {
+      const double product =
+          static_cast<double>(static_cast<float>(a[k])) *
+          static_cast<double>(static_cast<float>(b[k]));
+      exact += product;
+      magnitude += std::abs(product);
+    }
+    const double bound =
+        (dot_length + 1) * std::numeric_limits<float>::epsilon() * magnitude;
+    wrong += std::abs(static_cast<double>(acc[row]) - exact) > bound;
+  }
+  return wrong;
+}
+
+class to_bfloat16_kernel;
+class to_float_kernel;
+class copy_float_kernel;
+class multiply_bfloat16_kernel;
+class multiply_float_kernel;
+class add_bfloat16_kernel;
+class add_float_kernel;
+class dot_bfloat16_kernel;
+class dot_float_kernel;
+
+TEST_CASE("bfloat16 conversion and arithmetic throughput",
+          "[bfloat16][perf]") {
+  auto queue = get_cts_object::queue();
+  const sycl::range<1> range{element_count};
+
+  SECTION("conversion") {
+    const auto input = make_conversion_input();
+    std::vector<std::uint16_t> expected(element_count);
+    std::vector<bfloat16> bf16_input(element_count);
+    for (size_t i = 0; i < element_count; ++i) {
+      if (!std::isnan(input[i])) expected[i] = round_to_bfloat16_bits(input[i]);
+      // NaNs are converted by the device and only checked to stay NaN
+      bf16_input[i] = from_bits(std::isnan(input[i]) ? 0x7fc0 : expected[i]);
+    }
+
+    std::vector<bfloat16> bf16_output(element_count);
+    std::vector<float> float_output(element_count);
+    benchmark::sample_stats to_bf16;
+    benchmark::sample_stats to_fp32;
+    benchmark::sample_stats copy_fp32;
+    {
+      sycl::buffer<float, 1> float_in{input.data(), range};
+      sycl::buffer<bfloat16, 1> bf16_in{bf16_input.data(), range};
+      sycl::buffer<bfloat16, 1> bf16_out{bf16_output.data(), range};
+      sycl::buffer<float, 1> float_out{float_output.data(), range};
+      to_bf16 = measure_elementwise<to_bfloat16_kernel>(
+          queue, float_in, float_in, bf16_out,
+          [](float value, float) { return bfloat16(value); });
+      to_fp32 = measure_elementwise<to_float_kernel>(
+          queue, bf16_in, bf16_in, float_out,
+          [](bfloat16 value, bfloat16) { return static_cast<float>(value); });
+      // The same traffic without conversion, as a bound for the above
+      sycl::buffer<float, 1> copy_out{range};
+      copy_fp32 = measure_elementwise<copy_float_kernel>(
+          queue, float_in, float_in, copy_out,
+          [](float value, float) { return value; });
+    }
+
+    size_t wrong_to_bf16 = 0;
+    size_t wrong_to_fp32 = 0;
+    for (size_t i = 0; i < element_count; ++i) {
+      const std::uint16_t bits = to_bits(bf16_output[i]);
+      if (std::isnan(input[i])) {
+        wrong_to_bf16 += !is_nan_bits(bits);
+      } else {
+        wrong_to_bf16 += bits != expected[i];
+      }
+      const auto float_bits = sycl::bit_cast<std::uint32_t>(float_output[i]);
+      if (std::isnan(input[i])) {
+        wrong_to_fp32 += !std::isnan(float_output[i]);
+      } else {
+        wrong_to_fp32 += float_bits != (std::uint32_t{expected[i]} << 16);
+      }
+    }
+    CHECK(wrong_to_bf16 == 0);
+    CHECK(wrong_to_fp32 == 0);
+
+    report("float to bfloat16", to_bf16);
+    report("bfloat16 to float", to_fp32);
+    report("float copy without conversion", copy_fp32);
+  }
+
+  SECTION("elementwise arithmetic") {
+    const auto a = make_arithmetic_input(1);
+    const auto b = make_arithmetic_input(2);
+    std::vector<float> a_fp32(a.begin(), a.end());
+    std::vector<float> b_fp32(b.begin(), b.end());
+
+    std::vector<bfloat16> mul_bf16(element_count);
+    std::vector<bfloat16> add_bf16(element_count);
+    std::vector<float> mul_fp32(element_count);
+    std::vector<float> add_fp32(element_count);
+    benchmark::sample_stats mul_bf16_stats, add_bf16_stats;
+    benchmark::sample_stats mul_fp32_stats, add_fp32_stats;
+    {
+      sycl::buffer<bfloat16, 1> a_buf{a.data(), range};
+      sycl::buffer<bfloat16, 1> b_buf{b.data(), range};
+      sycl::buffer<float, 1> a_fp32_buf{a_fp32.data(), range};
+      sycl::buffer<float, 1> b_fp32_buf{b_fp32.data(), range};
+      sycl::buffer<bfloat16, 1> mul_bf16_buf{mul_bf16.data(), range};
+      sycl::buffer<bfloat16, 1> add_bf16_buf{add_bf16.data(), range};
+      sycl::buffer<float, 1> mul_fp32_buf{mul_fp32.data(), range};
+      sycl::buffer<float, 1> add_fp32_buf{add_fp32.data(), range};
+      mul_bf16_stats = measure_elementwise<multiply_bfloat16_kernel>(
+          queue, a_buf, b_buf, mul_bf16_buf,
+          [](bfloat16 x, bfloat16 y) { return x * y; });
+      add_bf16_stats = measure_elementwise<add_bfloat16_kernel>(
+          queue, a_buf, b_buf, add_bf16_buf,
+          [](bfloat16 x, bfloat16 y) { return x + y; });
+      mul_fp32_stats = measure_elementwise<multiply_float_kernel>(
+          queue, a_fp32_buf, b_fp32_buf, mul_fp32_buf,
+          [](float x, float y) { return x * y; });
+      add_fp32_stats = measure_elementwise<add_float_kernel>(
+          queue, a_fp32_buf, b_fp32_buf, add_fp32_buf,
+          [](float x, float y) { return x + y; });
+    }
+
+    size_t wrong_mul_bf16 = 0;
+    size_t wrong_add_bf16 = 0;
+    size_t wrong_mul_fp32 = 0;
+    size_t wrong_add_fp32 = 0;
+    for (size_t i = 0; i < element_count; ++i) {
+      const float x = a_fp32[i];
+      const float y = b_fp32[i];
+      // The product and, with magnitudes in [0.5, 4), the sum of two
+      // bfloat16 values are exact in float, so they are rounded once
+      wrong_mul_bf16 += to_bits(mul_bf16[i]) != round_to_bfloat16_bits(x * y);
+      wrong_add_bf16 += to_bits(add_bf16[i]) != round_to_bfloat16_bits(x + y);
+      wrong_mul_fp32 += mul_fp32[i] != x * y;
+      wrong_add_fp32 += add_fp32[i] != x + y;
+    }
+    CHECK(wrong_mul_bf16 == 0);
+    CHECK(wrong_add_bf16 == 0);
+    CHECK(wrong_mul_fp32 == 0);
+    CHECK(wrong_add_fp32 == 0);
+
+    report("bfloat16 multiplication", mul_bf16_stats);
+    report("float multiplication", mul_fp32_stats);
+    report_ratio("multiplication", mul_bf16_stats, mul_fp32_stats);
+    report("bfloat16 addition", add_bf16_stats);
+    report("float addition", add_fp32_stats);
+    report_ratio("addition", add_bf16_stats, add_fp32_stats);
+  }
+
+  SECTION("dot products") {
+    const auto a = make_arithmetic_input(3);
+    const auto b = make_arithmetic_input(4);
+    const std::vector<float> a_fp32(a.begin(), a.end());
+    const std::vector<float> b_fp32(b.begin(), b.end());
+
+    sycl::buffer<bfloat16, 1> a_buf{a.data(), range};
+    sycl::buffer<bfloat16, 1> b_buf{b.data(), range};
+    sycl::buffer<float, 1> a_fp32_buf{a_fp32.data(), range};
+    sycl::buffer<float, 1> b_fp32_buf{b_fp32.data(), range};
+    sycl::buffer<float, 1> bf16_out{sycl::range<1>{dot_count}};
+    sycl::buffer<float, 1> fp32_out{sycl::range<1>{dot_count}};
+
+    const auto bf16_stats =
+        measure_dot<dot_bfloat16_kernel>(queue, a_buf, b_buf, bf16_out);
+    const auto fp32_stats = measure_dot<dot_float_kernel>(
+        queue, a_fp32_buf, b_fp32_buf, fp32_out);
+    CHECK(count_wrong_dots(a, b, bf16_out) == 0);
+    CHECK(count_wrong_dots(a_fp32, b_fp32, fp32_out) == 0);
+
+    report("bfloat16 dot products of " + std::to_string(dot_length) +
+               " elements",
+           bf16_stats);
+    report("float dot products of " + std::to_string(dot_length) +
+               " elements",
+           fp32_stats);
+    report_ratio("dot products", bf16_stats, fp32_stats);
+  }
+}
+
+}  // namespace bfloat16_perf
@@ -0,0 +1,404 @@
+/*******************************************************************************
+//
+//  SYCL 2020 Conformance Test Suite
+//
+//  Copyright (c) 2026 The Khronos Group Inc.
+//
+//  Licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//
+//  Measures the cost of reading and writing a device_global in a kernel
+//  compared with the same accesses through a USM pointer argument, the
+//  latency and bandwidth of queue::copy and queue::memcpy between the host
+//  and a device_global, and the overhead of the first use of a device_global
+//  in a freshly built kernel bundle. Copies cover the types of type_pack.h as
+//  scalars and arrays of 5, then int arrays of up to 4 MiB.
+//
+*******************************************************************************/
+
+#include "../../common/benchmark.h"
+#include "../../common/common.h"
+#include "device_global_common.h"
+#include "type_pack.h"
+
+#include <algorithm>
+
+namespace device_global_perf {
+using namespace sycl_cts::util;
+using namespace device_global_common_functions;
+
+/** Number of timed runs of every kernel */
+constexpr size_t kernel_samples = 50;
+
+/** Number of timed runs of every copy */
+constexpr size_t copy_samples = 200;
+
+/** Number of freshly built kernel bundles timed */
+constexpr size_t first_use_samples = 10;
+
+/** Number of work items of the access kernels */
+constexpr size_t item_count = 1024;
+
+/** Number of accesses of every work item to distinct elements */
+constexpr size_t accesses_per_item = 64;
+
+/** Number of elements accessed by the access kernels */
+constexpr size_t access_element_count = item_count * accesses_per_item;
+
+/** Value written to the device_global by the first use kernel */
+constexpr int first_use_value = 42;
+
+/**
+ * @brief Value written by the access kernels to element \p k * item_count +
+ *        \p item
+ */
+inline int access_value(size_t item, size_t k) {
+  return static_cast<int>(item + k);
+}
+
+/**
+ * @brief Sum of the values read by work item \p item
+ */
+inline int expected_sum(size_t item) {
+  constexpr size_t n = accesses_per_item;
+  return static_cast<int>(n * item + n * (n - 1) / 2);
+}
+
+#if defined(SYCL_EXT_ONEAPI_PROPERTIES) && \
+    defined(SYCL_EXT_ONEAPI_DEVICE_GLOBAL)
+namespace oneapi = sycl::ext::oneapi;
+
+oneapi::experimental::device_global<int[access_element_count]> access_global;
+
+template <typename T>
+oneapi::experimental::device_global<T> copy_global;
+
+oneapi::experimental::device_global<int> first_use_global;
+
+class write_global_kernel;
+class read_global_kernel;
+class write_pointer_kernel;
+class read_pointer_kernel;
+class first_use_global_kernel;
+class first_use_plain_kernel;
+
+/**
+ * @brief Returns the number of elements of \p values differing from the
+ *        values written by the access kernels
+ */
+size_t count_wrong_elements(const std::vector<int>& values) {
+  size_t wrong = 0;
+  for (size_t k = 0; k < accesses_per_item; ++k)
+    for (size_t item = 0; item < item_count; ++item)
+      wrong += values[k * item_count + item] != access_value(item, k);
+  return wrong;
+}
+
+/**
+ * @brief Returns the number of work items of \p sums that read wrong values
+ */
+size_t count_wrong_sums(sycl::buffer<int, 1>& sums) {
+  sycl::host_accessor acc{sums, sycl::read_only};
+  size_t wrong = 0;
+  for (size_t item = 0; item < item_count; ++item)
+    wrong += acc[item] != expected_sum(item);
+  return wrong;
+}
+
+void report_access(const std::string& name,
+                   const benchmark::sample_stats& global_stats,
+                   const benchmark::sample_stats& pointer_stats) {
+  const double accesses = static_cast<double>(access_element_count);
+  WARN("[perf] " << name << ": device_global "
+                 << benchmark::format_rate(accesses, global_stats.p50,
+                                           "accesses")
+                 << ", USM pointer argument "
+                 << benchmark::format_rate(accesses, pointer_stats.p50,
+                                           "accesses")
+                 << ", device_global takes "
+                 << global_stats.p50 / pointer_stats.p50
+                 << "x the time");
+}
+
+/**
+ * @brief Times the kernels accessing the device_global and the USM pointer
+ */
+void measure_access(sycl::queue& queue) {
+  const sycl::range<1> range{item_count};
+  int* data = sycl::malloc_device<int>(access_element_count, queue);
+  REQUIRE(data != nullptr);
+  sycl::buffer<int, 1> sums{range};
+  std::vector<int> values(access_element_count);
+
+  const auto write_global = benchmark::measure(kernel_samples, [&] {
+    queue.parallel_for<write_global_kernel>(range, [=](sycl::id<1> id) {
+      for (size_t k = 0; k < accesses_per_item; ++k)
+        access_global[k * item_count + id[0]] = access_value(id[0], k);
+    });
+    queue.wait_and_throw();
+  });
+  queue.memcpy(values.data(), access_global).wait_and_throw();
+  CHECK(count_wrong_elements(values) == 0);
+
+  const auto read_global = benchmark::measure(kernel_samples, [&] {
+    queue.submit([&](sycl::handler& cgh) {
+      sycl::accessor acc{sums, cgh, sycl::write_only, sycl::no_init};
+      cgh.parallel_for<read_global_kernel>(range, [=](sycl::id<1> id) {
+        int sum = 0;
+        for (size_t k = 0; k < accesses_per_item; ++k)
+          sum += access_global[k * item_count + id[0]];
+        acc[id] = sum;
+      });
+    });
+    queue.wait_and_throw();
+  });
+  CHECK(count_wrong_sums(sums) == 0);
+
+  const auto write_pointer = benchmark::measure(kernel_samples, [&] {
+    queue.parallel_for<write_pointer_kernel>(range, [=](sycl::id<1> id) {
+      for (size_t k = 0; k < accesses_per_item; ++k)
+        data[k * item_count + id[0]] = access_value(id[0], k);
+    });
+    queue.wait_and_throw();
+  });
+  queue.memcpy(values.data(), data, access_element_count * sizeof(int))
+      .wait_and_throw();
+  CHECK(count_wrong_elements(values) == 0);
+
+  const auto read_pointer = benchmark::measure(kernel_samples, [&] {
+    queue.submit([&](sycl::handler& cgh) {
+      sycl::accessor acc{sums, cgh, sycl::write_only, sycl::no_init};
+      cgh.parallel_for<read_pointer_kernel>(range, [=](sycl::id<1> id) {
+        int sum = 0;
+        for (size_t k = 0; k < accesses_per_item; ++k)
+          sum += data[k * item_count + id[0]];
+        acc[id] = sum;
+      });
+    });
+    queue.wait_and_throw();
+  });
+  CHECK(count_wrong_sums(sums) == 0);
+  sycl::free(data, queue);
+
+  report_access("kernel writes", write_global, write_pointer);
+  report_access("kernel reads", read_global, read_pointer);
+}
+
+/**
+ * @brief Times copy and memcpy of a T between the host and copy_global<T>
+ * @param src Host data of sizeof(T) bytes to copy to the device_global
+ * @param other Host data of sizeof(T) bytes differing from \p src in every
+ *        element, written to the device_global before copy to it is timed
+ * @param dest Host storage of sizeof(T) bytes to copy the device_global to
+ */
+template <typename T>
+void measure_copies(sycl::queue& queue, const std::string& name,
+                    const std::remove_all_extents_t<T>* src,
+                    const std::remove_all_extents_t<T>* other,
+                    std::remove_all_extents_t<T>* dest) {
+  using element_t = std::remove_all_extents_t<T>;
+  constexpr size_t count = sizeof(T) / sizeof(element_t);
+  INFO(name);
+  const double bytes = sizeof(T);
+  // Otherwise copies doing nothing would not be detected
+  REQUIRE(std::equal(src, src + count, other,
+                     [](const element_t& a, const element_t& b) {
+                       return !(a == b);
+                     }));
+  auto check_dest = [&] {
+    CHECK(std::equal(src, src + count, dest));
+    std::copy(other, other + count, dest);
+  };
+  std::copy(other, other + count, dest);
+
+  queue.memcpy(copy_global<T>, other).wait_and_throw();
+  const auto memcpy_to = benchmark::measure(copy_samples, [&] {
+    queue.memcpy(copy_global<T>, src).wait_and_throw();
+  });
+  const auto memcpy_from = benchmark::measure(copy_samples, [&] {
+    queue.memcpy(dest, copy_global<T>).wait_and_throw();
+  });
+  check_dest();
+
+  queue.memcpy(copy_global<T>, other).wait_and_throw();
+  const auto copy_to = benchmark::measure(copy_samples, [&] {
+    queue.copy(src, copy_global<T>).wait_and_throw();
+  });
+  // Read back with memcpy, so copy to is verified on its own
+  queue.memcpy(dest, copy_global<T>).wait_and_throw();
+  check_dest();
+  const auto copy_from = benchmark::measure(copy_samples, [&] {
+    queue.copy(copy_global<T>, dest).wait_and_throw();
+  });
+  check_dest();
+
+  benchmark::report(name + ", memcpy to device_global", memcpy_to, bytes,
+                    "B");
+  benchmark::report(name + ", memcpy from device_global", memcpy_from, bytes,
+                    "B");
+  benchmark::report(name + ", copy to device_global", copy_to, bytes, "B");
+  benchmark::report(name + ", copy from device_global", copy_from, bytes,
+                    "B");
+}
+
+template <typename T>
+class measure_type_copies {
+ public:
+  void operator()(sycl::queue& queue, const std::string& type_name) {
+    // Odd values assign true to bool and even values false, so the two
+    // values differ for every type
+    T scalar_src{};
+    T scalar_other{};
+    T scalar_dest{};
+    value_operations::assign(scalar_src, 1);
+    value_operations::assign(scalar_other, 2);
+    measure_copies<T>(queue, type_name, &scalar_src, &scalar_other,
+                      &scalar_dest);
+
+    T array_src[5]{};
+    T array_other[5]{};
+    T array_dest[5]{};
+    value_operations::assign(array_src, 1);
+    value_operations::assign(array_other, 2);
+    measure_copies<T[5]>(queue, type_name + "[5]", array_src, array_other,
+                         array_dest);
+  }
+};
+
+/**
+ * @brief Times copies of int arrays of \p Count elements, allocated on the
+ *        heap as the largest do not fit on the stack
+ */
+template <size_t Count>
+void measure_int_array_copies(sycl::queue& queue) {
+  std::vector<int> src(Count);
+  std::vector<int> other(Count);
+  std::vector<int> dest(Count);
+  for (size_t i = 0; i < Count; ++i) {
+    src[i] = static_cast<int>(i * 3 + 1);
+    other[i] = static_cast<int>(i * 3 + 2);
+  }
+  measure_copies<int[Count]>(queue, "int[" + std::to_string(Count) + "]",
+                             src.data(), other.data(), dest.data());
+}
+
+/**
+ * @brief Build and launch times of a kernel in a new context
+ */
+struct first_use_times {
+  std::vector<double> build_ns;
+  std::vector<double> first_launch_ns;
+  std::vector<double> second_launch_ns;
+};
+
+/**
+ * @brief Builds the bundle of \p KernelT in a new context every sample and
+ *        times its first two launches
+ * @param submit Callable submitting KernelT to a queue with an output
+ *        accessor
+ */
+template <typename KernelT, typename SubmitT>
+first_use_times measure_first_use(const sycl::device& device,
+                                  SubmitT&& submit) {
+  first_use_times times;
+  const auto kernel_id = sycl::get_kernel_id<KernelT>();
+  for (size_t i = 0; i < first_use_samples; ++i) {
+    const sycl::context context{device};
+    sycl::queue queue{context, device};
+    const auto start = benchmark::clock::now();
+    const auto bundle =
+        sycl::get_kernel_bundle<sycl::bundle_state::executable>(
+            context, {device}, {kernel_id});
+    times.build_ns.push_back(
+        benchmark::elapsed_ns(start, benchmark::clock::now()));
+    int result = 0;
+    {
+      sycl::buffer<int, 1> buf{&result, sycl::range<1>{1}};
+      auto launch = [&] {
+        queue.submit([&](sycl::handler& cgh) {
+          cgh.use_kernel_bundle(bundle);
+          submit(cgh, sycl::accessor{buf, cgh, sycl::write_only});
+        });
+        queue.wait_and_throw();
+      };
+      times.first_launch_ns.push_back(benchmark::time_ns(launch));
+      times.second_launch_ns.push_back(benchmark::time_ns(launch));
+    }
+    CHECK(result == first_use_value);
+  }
+  return times;
+}
+
+void report_first_use(const std::string& name, first_use_times& times) {
+  const auto build = benchmark::get_stats(std::move(times.build_ns));
+  const auto first = benchmark::get_stats(std::move(times.first_launch_ns));
+  const auto second = benchmark::get_stats(std::move(times.second_launch_ns));
+  WARN("[perf] " << name << ": bundle build "
+                 << benchmark::format_duration(build.p50)
+                 << ", first launch "
+                 << benchmark::format_duration(first.p50)
+                 << ", second launch "
+                 << benchmark::format_duration(second.p50));
+}
+
+#endif
+
+TEST_CASE("device_global access cost, copy bandwidth and first use",
+          "[oneapi_device_global][perf]") {
+#if !defined(SYCL_EXT_ONEAPI_PROPERTIES)
+  SKIP("SYCL_EXT_ONEAPI_PROPERTIES is not defined");
+#elif !defined(SYCL_EXT_ONEAPI_DEVICE_GLOBAL)
+  SKIP("SYCL_EXT_ONEAPI_DEVICE_GLOBAL is not defined");
+#else
+  auto queue = get_cts_object::queue();
+  const auto device = queue.get_device();
+
+  SECTION("kernel access compared with a USM pointer argument") {
+    if (!device.has(sycl::aspect::usm_device_allocations)) {
+      SKIP("Device does not support USM device allocations");
+    }
+    measure_access(queue);
+  }
+
+  SECTION("copy and memcpy latency of type_pack.h types") {
+    for_all_types<measure_type_copies>(device_global_types::get_types(),
+                                       queue);
+  }
+
+  SECTION("copy and memcpy bandwidth of int arrays") {
+    measure_int_array_copies<size_t{1} << 10>(queue);
+    measure_int_array_copies<size_t{1} << 16>(queue);
+    measure_int_array_copies<size_t{1} << 20>(queue);
+  }
+
+  SECTION("first use in a new kernel bundle") {
+    // Both kernels write first_use_value, one of them through the
+    // device_global, so the difference is the cost of its first use
+    auto plain = measure_first_use<first_use_plain_kernel>(
+        device, [](sycl::handler& cgh, auto acc) {
+          cgh.single_task<first_use_plain_kernel>(
+              [=] { acc[0] = first_use_value; });
+        });
+    auto global = measure_first_use<first_use_global_kernel>(
+        device, [](sycl::handler& cgh, auto acc) {
+          cgh.single_task<first_use_global_kernel>([=] {
+            first_use_global.get() = first_use_value;
+            acc[0] = first_use_global.get();
+          });
+        });
+    report_first_use("kernel without device_global", plain);
+    report_first_use("kernel using a device_global", global);
+  }
+#endif
+}
+
+}  // namespace device_global_perf
@@ -0,0 +1,114 @@
+/*******************************************************************************
+//
+//  SYCL 2020 Conformance Test Suite
+//
+//  Copyright (c) 2026 The Khronos Group Inc.
+//
+//  Licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//
+//  Measures the latency of submitting empty kernels through the enqueue free
+//  functions, for in-order and out-of-order queues, with and without
+//  discard_events, and with and without a dependency on the previous command.
+//
+*******************************************************************************/
+
+#include "../../common/submission_benchmark.h"
+
+namespace enqueue_functions::perf {
+using namespace sycl_cts::util;
+
+#ifdef SYCL_EXT_ONEAPI_ENQUEUE_FUNCTIONS
+namespace oneapi_ext = sycl::ext::oneapi::experimental;
+
+/**
+ * @brief Measures every enqueue function on \p queue
+ * @param with_dependency Whether every command depends on the event of the
+ *        previous one. Needs events, so it is only used for queues without
+ *        discard_events.
+ */
+void measure_queue(sycl::queue& queue, const std::string& queue_name,
+                   bool with_dependency) {
+  const std::string config =
+      queue_name + (with_dependency ? ", depends on previous" : "");
+  const sycl::range<1> range{1};
+
+  if (with_dependency) {
+    sycl::event last;
+    benchmark::measure_submission(
+        queue, "submit_with_event single_task, " + config, [&] {
+          last = oneapi_ext::submit_with_event(queue, [&](sycl::handler& h) {
+            h.depends_on(last);
+            oneapi_ext::single_task(h, [] {});
+          });
+        });
+    benchmark::measure_submission(
+        queue, "submit_with_event nd_launch, " + config, [&] {
+          last = oneapi_ext::submit_with_event(queue, [&](sycl::handler& h) {
+            h.depends_on(last);
+            oneapi_ext::nd_launch(h, sycl::nd_range<1>{range, range},
+                                  [](sycl::nd_item<1>) {});
+          });
+        });
+    return;
+  }
+
+  benchmark::measure_submission(queue, "single_task, " + config, [&] {
+    oneapi_ext::single_task(queue, [] {});
+  });
+  benchmark::measure_submission(queue, "parallel_for, " + config, [&] {
+    oneapi_ext::parallel_for(queue, range, [](sycl::id<1>) {});
+  });
+  benchmark::measure_submission(queue, "nd_launch, " + config, [&] {
+    oneapi_ext::nd_launch(queue, sycl::nd_range<1>{range, range},
+                          [](sycl::nd_item<1>) {});
+  });
+  benchmark::measure_submission(queue, "submit single_task, " + config, [&] {
+    oneapi_ext::submit(queue, [&](sycl::handler& h) {
+      oneapi_ext::single_task(h, [] {});
+    });
+  });
+}
+#endif  // SYCL_EXT_ONEAPI_ENQUEUE_FUNCTIONS
+
+TEST_CASE("Submission latency of the enqueue functions",
+          "[oneapi_enqueue_functions][perf]") {
+#ifndef SYCL_EXT_ONEAPI_ENQUEUE_FUNCTIONS
+  SKIP("SYCL_EXT_ONEAPI_ENQUEUE_FUNCTIONS is not defined");
+#else
+  SECTION("out-of-order queue") {
+    auto queue = benchmark::make_queue({});
+    measure_queue(queue, "out-of-order queue", false);
+    measure_queue(queue, "out-of-order queue", true);
+  }
+  SECTION("in-order queue") {
+    auto queue = benchmark::make_queue({sycl::property::queue::in_order{}});
+    measure_queue(queue, "in-order queue", false);
+    measure_queue(queue, "in-order queue", true);
+  }
+#ifdef SYCL_EXT_ONEAPI_DISCARD_QUEUE_EVENTS
+  SECTION("out-of-order queue with discard_events") {
+    auto queue = benchmark::make_queue(
+        {sycl::ext::oneapi::property::queue::discard_events{}});
+    measure_queue(queue, "out-of-order queue, discard_events", false);
+  }
+  SECTION("in-order queue with discard_events") {
+    auto queue = benchmark::make_queue(
+        {sycl::ext::oneapi::property::queue::discard_events{},
+         sycl::property::queue::in_order{}});
+    measure_queue(queue, "in-order queue, discard_events", false);
+  }
+#endif  // SYCL_EXT_ONEAPI_DISCARD_QUEUE_EVENTS
+#endif  // SYCL_EXT_ONEAPI_ENQUEUE_FUNCTIONS
+}
+
+}  // namespace enqueue_functions::perf
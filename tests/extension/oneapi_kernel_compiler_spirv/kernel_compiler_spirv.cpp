@@ -19,23 +19,10 @@
 *******************************************************************************/
 
 #include "../../common/common.h"
+#include "kernel_compiler_spirv_common.h"
 
 namespace kernel_compiler_spirv::tests {
-
-template <typename... Ts>
-std::vector<std::byte> createByteVector(Ts&&... args) noexcept {
-  return {std::byte(std::forward<Ts>(args))...};
-}
-
-static const std::vector<std::byte> kernels = createByteVector(
-#include "kernels.inc"
-);
-static const std::vector<std::byte> kernels_fp16 = createByteVector(
-#include "kernels_fp16.inc"
-);
-static const std::vector<std::byte> kernels_fp64 = createByteVector(
-#include "kernels_fp64.inc"
-);
+using namespace kernel_compiler_spirv_common;
 
 #ifdef SYCL_EXT_ONEAPI_AUTO_LOCAL_RANGE
 
@@ -0,0 +1,73 @@
+/*******************************************************************************
+//
+//  SYCL 2020 Conformance Test Suite
+//
+//  Copyright (c) 2026 The Khronos Group Inc.
+//
+//  Licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//
+//  Provides the SPIR-V modules used by the kernel_compiler_spirv tests
+//
+*******************************************************************************/
+
+#ifndef __SYCLCTS_TESTS_EXTENSION_KERNEL_COMPILER_SPIRV_COMMON_H
+#define __SYCLCTS_TESTS_EXTENSION_KERNEL_COMPILER_SPIRV_COMMON_H
+
+#include "../../common/common.h"
+
+#include <optional>
+
+namespace kernel_compiler_spirv_common {
+
+template <typename... Ts>
+std::vector<std::byte> createByteVector(Ts&&... args) noexcept {
+  return {std::byte(std::forward<Ts>(args))...};
+}
+
+inline const std::vector<std::byte> kernels = createByteVector(
+#include "kernels.inc"
+);
+inline const std::vector<std::byte> kernels_fp16 = createByteVector(
+#include "kernels_fp16.inc"
+);
+inline const std::vector<std::byte> kernels_fp64 = createByteVector(
+#include "kernels_fp64.inc"
+);
+
+/**
+ * @brief Describes a SPIR-V module, one of the kernels it defines and the
+ *        aspect the device needs to build it, if any
+ */
+struct spirv_module {
+  const char* name;
+  const std::vector<std::byte>* bytes;
+  const char* kernel_name;
+  std::optional<sycl::aspect> aspect;
+};
+
+inline const spirv_module modules[] = {
+    {"kernels.spv", &kernels, "my_kernel", std::nullopt},
+    {"kernels_fp16.spv", &kernels_fp16, "OpTypeFloat16", sycl::aspect::fp16},
+    {"kernels_fp64.spv", &kernels_fp64, "OpTypeFloat64", sycl::aspect::fp64}};
+
+/**
+ * @brief Checks whether \p device can build \p module
+ */
+inline bool is_supported(const sycl::device& device,
+                         const spirv_module& module) {
+  return !module.aspect || device.has(*module.aspect);
+}
+
+}  // namespace kernel_compiler_spirv_common
+
+#endif  // __SYCLCTS_TESTS_EXTENSION_KERNEL_COMPILER_SPIRV_COMMON_H
@@ -0,0 +1,263 @@
+/*******************************************************************************
+//
+//  SYCL 2020 Conformance Test Suite
+//
+//  Copyright (c) 2026 The Khronos Group Inc.
+//
+//  Licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//
+//  Loads kernels.spv and, when the device supports fp16 and fp64, the
+//  modules using those types hundreds of times through
+//  create_kernel_bundle_from_source and build; kernels.spv is also loaded
+//  from several threads. Reports the load latency, the memory held by every
+//  loaded bundle and the memory left after bundles are released. Loads of
+//  identical SPIR-V are compared with loads of modules differing only in the
+//  generator word of the header to detect whether identical modules are
+//  deduplicated.
+//
+*******************************************************************************/
+
+#include "../../common/benchmark.h"
+#include "../../common/common.h"
+#include "../../common/once_per_unit.h"
+#include "kernel_compiler_spirv_common.h"
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <thread>
+
+namespace kernel_compiler_spirv_perf {
+using namespace sycl_cts::util;
+using namespace kernel_compiler_spirv_common;
+
+/** Number of bundles loaded sequentially */
+constexpr size_t load_count = 200;
+
+/** Number of bundles loaded by every thread */
+constexpr size_t thread_load_count = 50;
+
+/** Upper limit of the number of loading threads */
+constexpr size_t max_thread_count = 8;
+
+/** Loads faster than the first one by this factor are served by a cache */
+constexpr double cache_hit_ratio = 2.0;
+
+/**
+ * @brief Returns a copy of \p module with a different generator word in the
+ *        SPIR-V header; the module is otherwise identical
+ */
+std::vector<std::byte> make_distinct(const std::vector<std::byte>& module,
+                                     size_t index) {
+  constexpr size_t generator_offset = 2 * sizeof(std::uint32_t);
+  std::vector<std::byte> result = module;
+  for (size_t i = 0; i < sizeof(std::uint32_t); ++i)
+    result[generator_offset + i] ^= std::byte((index + 1) >> (8 * i));
+  return result;
+}
+
+#ifdef SYCL_EXT_ONEAPI_KERNEL_COMPILER_SPIRV
+
+using executable_bundle = sycl::kernel_bundle<sycl::bundle_state::executable>;
+
+executable_bundle load(const sycl::context& context,
+                       const std::vector<std::byte>& module) {
+  namespace syclex = sycl::ext::oneapi::experimental;
+  auto source = syclex::create_kernel_bundle_from_source(
+      context, syclex::source_language::spirv, module);
+  return syclex::build(source);
+}
+
+/**
+ * @brief Runs "my_kernel" of \p bundle, which computes 2 * x + 100, and
+ *        returns whether the results are correct
+ */
+bool run_my_kernel(sycl::queue& queue, executable_bundle& bundle) {
+  if (!bundle.ext_oneapi_has_kernel("my_kernel")) return false;
+  const auto kernel = bundle.ext_oneapi_get_kernel("my_kernel");
+  constexpr int count = 4;
+  std::array<int, count> input{0, 1, 2, 3};
+  std::array<int, count> output{};
+  {
+    sycl::buffer<int> input_buffer{input.data(), sycl::range<1>{count}};
+    sycl::buffer<int> output_buffer{output.data(), sycl::range<1>{count}};
+    queue.submit([&](sycl::handler& cgh) {
+      cgh.set_args(sycl::accessor{input_buffer, cgh, sycl::read_only},
+                   sycl::accessor{output_buffer, cgh, sycl::write_only});
+      cgh.parallel_for(sycl::range<1>{count}, kernel);
+    });
+  }
+  for (int i = 0; i < count; ++i) {
+    if (output[i] != 2 * i + 100) return false;
+  }
+  return true;
+}
+
+/**
+ * @brief Returns whether \p bundle built from \p module is usable: the
+ *        kernel of kernels.spv is run, the kernels of the other modules have
+ *        to be present
+ */
+bool check_bundle(sycl::queue& queue, executable_bundle& bundle,
+                  const spirv_module& module) {
+  if (module.bytes == &kernels) return run_my_kernel(queue, bundle);
+  return bundle.ext_oneapi_has_kernel(module.kernel_name);
+}
+
+/**
+ * @brief Loads load_count modules returned by \p get_module keeping all the
+ *        bundles alive, reports latency and memory, then releases them
+ * @retval Median load latency after the first load
+ */
+template <typename GetModuleT>
+double measure_loads(sycl::queue& queue, const std::string& name,
+                     const spirv_module& module, GetModuleT&& get_module) {
+  INFO(name);
+  const auto context = queue.get_context();
+  std::vector<executable_bundle> bundles;
+  std::vector<double> load_ns;
+  bundles.reserve(load_count);
+  const size_t rss_before = benchmark::get_current_rss();
+  for (size_t i = 0; i < load_count; ++i) {
+    const auto bytes = get_module(i);
+    load_ns.push_back(benchmark::time_ns(
+        [&] { bundles.push_back(load(context, bytes)); }));
+  }
+  const size_t rss_loaded = benchmark::get_current_rss();
+  CHECK(check_bundle(queue, bundles.front(), module));
+  CHECK(check_bundle(queue, bundles.back(), module));
+  bundles.clear();
+  const size_t rss_released = benchmark::get_current_rss();
+
+  const double first_ns = load_ns.front();
+  const auto rest = benchmark::get_stats(
+      std::vector<double>(load_ns.begin() + 1, load_ns.end()));
+  WARN("[perf] " << name << ": first load "
+                 << benchmark::format_duration(first_ns) << ", later loads "
+                 << benchmark::format_stats(rest)
+                 << (first_ns >= cache_hit_ratio * rest.p50
+                         ? "; later loads hit a cache"
+                         : ""));
+  if (rss_before != 0) {
+    const double held =
+        static_cast<double>(rss_loaded) - static_cast<double>(rss_before);
+    const double retained =
+        static_cast<double>(rss_released) - static_cast<double>(rss_before);
+    WARN("[perf] " << name << ": "
+                   << benchmark::format_bytes(held / load_count)
+                   << " of resident memory per live bundle, "
+                   << benchmark::format_bytes(retained)
+                   << " still resident after releasing all " << load_count
+                   << " bundles");
+  }
+  return rest.p50;
+}
+
+#endif
+
+TEST_CASE("Kernel compiler SPIR-V load latency, memory and deduplication",
+          "[oneapi_kernel_compiler_spirv][perf]") {
+#ifndef SYCL_EXT_ONEAPI_KERNEL_COMPILER_SPIRV
+  SKIP("SYCL_EXT_ONEAPI_KERNEL_COMPILER_SPIRV is not defined");
+#else
+  auto queue = once_per_unit::get_queue();
+  const auto context = queue.get_context();
+
+  const auto device = queue.get_device();
+
+  SECTION("identical and distinct modules") {
+    for (const auto& module : modules) {
+      if (!is_supported(device, module)) continue;
+      const auto& bytes = *module.bytes;
+      const std::string name = module.name;
+      const double identical_ns =
+          measure_loads(queue, name + ", identical SPIR-V", module,
+                        [&](size_t) { return bytes; });
+      const double distinct_ns = measure_loads(
+          queue, name + ", SPIR-V differing in the header only", module,
+          [&](size_t i) { return make_distinct(bytes, i); });
+      WARN("[perf] " << name << ": distinct / identical module load latency = "
+                     << distinct_ns / identical_ns
+                     << (distinct_ns >= cache_hit_ratio * identical_ns
+                             ? "; identical modules are deduplicated"
+                             : "; no deduplication of identical modules "
+                               "detected"));
+    }
+  }
+
+  SECTION("load and release") {
+    for (const auto& module : modules) {
+      if (!is_supported(device, module)) continue;
+      const auto& bytes = *module.bytes;
+      const std::string name = module.name;
+      // Warm up, so allocations made once by the runtime are not counted
+      for (size_t i = 0; i < 10; ++i) static_cast<void>(load(context, bytes));
+      const size_t rss_before = benchmark::get_current_rss();
+      const auto stats = benchmark::measure(load_count, [&] {
+        auto bundle = load(context, bytes);
+        static_cast<void>(bundle);
+      });
+      const size_t rss_after = benchmark::get_current_rss();
+      benchmark::report(name + ", load and release identical SPIR-V", stats);
+      if (rss_before != 0) {
+        const double growth =
+            static_cast<double>(rss_after) - static_cast<double>(rss_before);
+        WARN("[perf] " << name << ": resident memory growth over "
+                       << load_count + 1 << " loads of released bundles: "
+                       << benchmark::format_bytes(growth) << ", "
+                       << benchmark::format_bytes(growth / (load_count + 1))
+                       << " per load");
+      }
+      auto bundle = load(context, bytes);
+      CHECK(check_bundle(queue, bundle, module));
+    }
+  }
+
+  SECTION("multiple threads") {
+    const size_t thread_count = std::clamp<size_t>(
+        std::thread::hardware_concurrency(), 2, max_thread_count);
+    auto run_threads = [&](size_t count) {
+      std::atomic<size_t> failures{0};
+      const double ns = benchmark::time_ns([&] {
+        std::vector<std::thread> threads;
+        for (size_t t = 0; t < count; ++t) {
+          threads.emplace_back([&] {
+            try {
+              for (size_t i = 0; i < thread_load_count; ++i) {
+                auto bundle = load(context, kernels);
+                if (!bundle.ext_oneapi_has_kernel("my_kernel")) ++failures;
+              }
+            } catch (const sycl::exception&) {
+              ++failures;
+            }
+          });
+        }
+        for (auto& thread : threads) thread.join();
+      });
+      CHECK(failures.load() == 0);
+      WARN("[perf] " << count << " thread(s) loading "
+                     << thread_load_count << " bundles each: "
+                     << benchmark::format_rate(
+                            static_cast<double>(count * thread_load_count),
+                            ns, "bundles"));
+      return ns / (count * thread_load_count);
+    };
+    const double single_ns = run_threads(1);
+    const double multi_ns = run_threads(thread_count);
+    WARN("[perf] loading from " << thread_count << " threads scales by "
+                                << single_ns / multi_ns << "x");
+  }
+#endif
+}
+
+}  // namespace kernel_compiler_spirv_perf
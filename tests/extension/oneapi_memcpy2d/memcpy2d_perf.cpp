@@ -0,0 +1,293 @@
+/*******************************************************************************
+//
+//  SYCL 2020 Conformance Test Suite
+//
+//  Copyright (c) 2026 The Khronos Group Inc.
+//
+//  Licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//
+//  Measures the bandwidth of ext_oneapi_memcpy2d, ext_oneapi_copy2d,
+//  ext_oneapi_memset2d and ext_oneapi_fill2d on regions of up to 16 MiB with
+//  narrow and wide rows, for every pair of source and destination pointer
+//  kinds. Every operation is compared with a loop of 1D operations, one per
+//  row, and the results are verified including the padding between rows.
+//
+*******************************************************************************/
+
+#include "../../common/benchmark.h"
+#include "memcpy2d_common.h"
+
+#include <cstdint>
+
+namespace memcpy2d_perf {
+using namespace memcpy2d_common_tests;
+using namespace sycl_cts::util;
+
+/** Number of timed runs of every operation */
+constexpr size_t sample_count = 10;
+
+/** Value of the destination bytes outside the region */
+constexpr unsigned char padding_value = 0xee;
+
+/** Value written by memset2d and fill2d */
+constexpr std::uint32_t fill_value = 0x5a5a5a5a;
+
+/**
+ * @brief Copied or filled region; widths and pitches are in bytes and are
+ *        multiples of sizeof(std::uint32_t) so copy2d and fill2d can be used
+ */
+struct region {
+  size_t width;
+  size_t height;
+  size_t src_pitch;
+  size_t dest_pitch;
+
+  size_t bytes() const { return width * height; }
+
+  std::string get_name() const {
+    return std::to_string(width) + " B x " + std::to_string(height) +
+           " rows, pitches " + std::to_string(src_pitch) + "/" +
+           std::to_string(dest_pitch);
+  }
+};
+
+constexpr region regions[] = {{64, 65536, 96, 128},
+                              {1024, 4096, 1280, 1536},
+                              {4096, 4096, 4608, 8192},
+                              {65536, 256, 65536, 65600}};
+
+/**
+ * @brief Value of the source byte at \p row and \p col
+ */
+inline unsigned char source_value(size_t row, size_t col) {
+  return static_cast<unsigned char>(row * 7 + col);
+}
+
+/**
+ * @brief Copies \p bytes from \p src to \p dest of any pointer kinds
+ */
+void transfer(sycl::queue& queue, void* dest, const void* src, size_t bytes) {
+  queue.memcpy(dest, src, bytes).wait_and_throw();
+}
+
+/**
+ * @brief Returns the number of rows of \p dest differing from the expected
+ *        region contents or padding
+ * @param expected Callable taking row and column, returning the byte value
+ */
+template <typename ExpectedT>
+size_t count_wrong_rows(sycl::queue& queue, const unsigned char* dest,
+                        const region& shape, ExpectedT&& expected) {
+  std::vector<unsigned char> result(shape.dest_pitch * shape.height);
+  transfer(queue, result.data(), dest, result.size());
+  size_t wrong_rows = 0;
+  for (size_t row = 0; row < shape.height; ++row) {
+    for (size_t col = 0; col < shape.dest_pitch; ++col) {
+      const unsigned char value =
+          col < shape.width ? expected(row, col) : padding_value;
+      if (result[row * shape.dest_pitch + col] != value) {
+        ++wrong_rows;
+        break;
+      }
+    }
+  }
+  return wrong_rows;
+}
+
+/**
+ * @brief Times \p operation, which submits work to \p queue, and checks
+ *        the result; the destination is reset to padding_value first
+ */
+template <typename OperationT, typename ExpectedT>
+benchmark::sample_stats measure_operation(sycl::queue& queue,
+                                          unsigned char* dest,
+                                          const region& shape,
+                                          const std::string& name,
+                                          OperationT&& operation,
+                                          ExpectedT&& expected) {
+  INFO(name);
+  const std::vector<unsigned char> padding(shape.dest_pitch * shape.height,
+                                           padding_value);
+  transfer(queue, dest, padding.data(), padding.size());
+  const auto stats = benchmark::measure(sample_count, [&] {
+    operation();
+    queue.wait_and_throw();
+  });
+  CHECK(count_wrong_rows(queue, dest, shape, expected) == 0);
+  return stats;
+}
+
+void report_comparison(const std::string& name, const region& shape,
+                       const benchmark::sample_stats& op_2d,
+                       const benchmark::sample_stats& loop) {
+  const double bytes = static_cast<double>(shape.bytes());
+  WARN("[perf] " << name << ", " << shape.get_name() << ": 2D "
+                 << benchmark::format_rate(bytes, op_2d.p50, "B")
+                 << ", loop of 1D "
+                 << benchmark::format_rate(bytes, loop.p50, "B")
+                 << ", 2D is " << loop.p50 / op_2d.p50 << "x as fast");
+}
+
+#ifdef SYCL_EXT_ONEAPI_MEMCPY2D
+
+template <typename SrcPtrT, typename DestPtrT>
+class run_copy_bandwidth {
+  static constexpr pointer_type SrcPtrType = SrcPtrT::value;
+  static constexpr pointer_type DestPtrType = DestPtrT::value;
+
+ public:
+  void operator()(sycl::queue& queue, const std::string& src_ptr_type_name,
+                  const std::string& dest_ptr_type_name) {
+    const std::string pair = src_ptr_type_name + " -> " + dest_ptr_type_name;
+    if (!check_device_aspect_allocations<SrcPtrType, DestPtrType>(queue)) {
+      WARN("Skipping " << pair << ": USM allocations are not supported");
+      return;
+    }
+    for (const auto& shape : regions) {
+      INFO(pair << ", " << shape.get_name());
+      auto src = allocate_memory<unsigned char, SrcPtrType>(
+          shape.src_pitch * shape.height, queue);
+      auto dest = allocate_memory<unsigned char, DestPtrType>(
+          shape.dest_pitch * shape.height, queue);
+      REQUIRE(src != nullptr);
+      REQUIRE(dest != nullptr);
+      std::vector<unsigned char> src_data(shape.src_pitch * shape.height);
+      for (size_t row = 0; row < shape.height; ++row)
+        for (size_t col = 0; col < shape.src_pitch; ++col)
+          src_data[row * shape.src_pitch + col] = source_value(row, col);
+      transfer(queue, src.get(), src_data.data(), src_data.size());
+
+      unsigned char* src_ptr = src.get();
+      unsigned char* dest_ptr = dest.get();
+      using word = std::uint32_t;
+      const auto memcpy2d = measure_operation(
+          queue, dest_ptr, shape, "memcpy2d",
+          [&] {
+            queue.ext_oneapi_memcpy2d(dest_ptr, shape.dest_pitch, src_ptr,
+                                      shape.src_pitch, shape.width,
+                                      shape.height);
+          },
+          source_value);
+      const auto copy2d = measure_operation(
+          queue, dest_ptr, shape, "copy2d",
+          [&] {
+            queue.ext_oneapi_copy2d(
+                reinterpret_cast<const word*>(src_ptr),
+                shape.src_pitch / sizeof(word),
+                reinterpret_cast<word*>(dest_ptr),
+                shape.dest_pitch / sizeof(word), shape.width / sizeof(word),
+                shape.height);
+          },
+          source_value);
+      const auto loop = measure_operation(
+          queue, dest_ptr, shape, "loop of memcpy",
+          [&] {
+            for (size_t row = 0; row < shape.height; ++row)
+              queue.memcpy(dest_ptr + row * shape.dest_pitch,
+                           src_ptr + row * shape.src_pitch, shape.width);
+          },
+          source_value);
+      report_comparison(pair + ", memcpy2d", shape, memcpy2d, loop);
+      report_comparison(pair + ", copy2d", shape, copy2d, loop);
+    }
+  }
+};
+
+template <typename DestPtrT>
+class run_fill_bandwidth {
+  static constexpr pointer_type DestPtrType = DestPtrT::value;
+
+ public:
+  void operator()(sycl::queue& queue, const std::string& dest_ptr_type_name) {
+    // The 1D memset and fill used for comparison require USM pointers
+    if constexpr (DestPtrType == pointer_type::host) return;
+    if (!check_device_aspect_allocations<DestPtrType>(queue)) {
+      WARN("Skipping " << dest_ptr_type_name
+                       << ": USM allocations are not supported");
+      return;
+    }
+    const auto byte_value = static_cast<unsigned char>(fill_value);
+    auto filled = [=](size_t, size_t) { return byte_value; };
+    for (const auto& shape : regions) {
+      INFO(dest_ptr_type_name << ", " << shape.get_name());
+      auto dest = allocate_memory<unsigned char, DestPtrType>(
+          shape.dest_pitch * shape.height, queue);
+      REQUIRE(dest != nullptr);
+      unsigned char* dest_ptr = dest.get();
+      using word = std::uint32_t;
+      const size_t pitch_words = shape.dest_pitch / sizeof(word);
+      const size_t width_words = shape.width / sizeof(word);
+
+      const auto memset2d = measure_operation(
+          queue, dest_ptr, shape, "memset2d",
+          [&] {
+            queue.ext_oneapi_memset2d(dest_ptr, shape.dest_pitch, byte_value,
+                                      shape.width, shape.height);
+          },
+          filled);
+      const auto memset_loop = measure_operation(
+          queue, dest_ptr, shape, "loop of memset",
+          [&] {
+            for (size_t row = 0; row < shape.height; ++row)
+              queue.memset(dest_ptr + row * shape.dest_pitch, byte_value,
+                           shape.width);
+          },
+          filled);
+      const auto fill2d = measure_operation(
+          queue, dest_ptr, shape, "fill2d",
+          [&] {
+            queue.ext_oneapi_fill2d(reinterpret_cast<word*>(dest_ptr),
+                                    pitch_words, fill_value, width_words,
+                                    shape.height);
+          },
+          filled);
+      const auto fill_loop = measure_operation(
+          queue, dest_ptr, shape, "loop of fill",
+          [&] {
+            auto* words = reinterpret_cast<word*>(dest_ptr);
+            for (size_t row = 0; row < shape.height; ++row)
+              queue.fill(words + row * pitch_words, fill_value, width_words);
+          },
+          filled);
+      report_comparison(dest_ptr_type_name + ", memset2d", shape, memset2d,
+                        memset_loop);
+      report_comparison(dest_ptr_type_name + ", fill2d", shape, fill2d,
+                        fill_loop);
+    }
+  }
+};
+
+#endif
+
+TEST_CASE("memcpy2d and copy2d bandwidth by pointer kinds",
+          "[oneapi_memcpy2d][perf]") {
+#ifndef SYCL_EXT_ONEAPI_MEMCPY2D
+  SKIP("SYCL_EXT_ONEAPI_MEMCPY2D is not defined");
+#else
+  auto queue = get_cts_object::queue();
+  for_all_combinations<run_copy_bandwidth>(get_pointer_types(),
+                                           get_pointer_types(), queue);
+#endif
+}
+
+TEST_CASE("memset2d and fill2d bandwidth by pointer kind",
+          "[oneapi_memcpy2d][perf]") {
+#ifndef SYCL_EXT_ONEAPI_MEMCPY2D
+  SKIP("SYCL_EXT_ONEAPI_MEMCPY2D is not defined");
+#else
+  auto queue = get_cts_object::queue();
+  for_all_combinations<run_fill_bandwidth>(get_pointer_types(), queue);
+#endif
+}
+
+}  // namespace memcpy2d_perf
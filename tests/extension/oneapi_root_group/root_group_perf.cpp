@@ -0,0 +1,203 @@
+/*******************************************************************************
+//
+//  SYCL 2020 Conformance Test Suite
+//
+//  Copyright (c) 2026 The Khronos Group Inc.
+//
+//  Licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//
+//  Measures the latency of group_barrier on a root group for work-group
+//  counts of 1 up to max_num_work_group_sync. Every kernel runs many rounds
+//  of a neighbour exchange separated by root group barriers, and the same
+//  rounds are also run as one kernel launch each, to find the work-group
+//  counts at which a cooperative kernel beats relaunching.
+//
+*******************************************************************************/
+
+#include "../../common/benchmark.h"
+#include "../../common/common.h"
+
+#include <algorithm>
+#include <numeric>
+#include <optional>
+#include <utility>
+
+namespace root_group_perf {
+using namespace sycl_cts::util;
+
+/** Number of exchange rounds, and root group barriers, of every kernel */
+constexpr size_t round_count = 1000;
+
+/** Number of timed runs at every work-group count */
+constexpr size_t sample_count = 10;
+
+/** Upper limit of the work-group size */
+constexpr size_t max_local_size = 64;
+
+/**
+ * @brief Value of element \p i of \p n after \p rounds rounds of
+ *        next[i] = current[(i + 1) % n] + 1 starting from current[i] = i
+ */
+inline int expected_value(size_t i, size_t n, size_t rounds) {
+  return static_cast<int>((i + rounds) % n + rounds);
+}
+
+#ifdef SYCL_EXT_ONEAPI_ROOT_GROUP
+namespace syclex = sycl::ext::oneapi::experimental;
+
+class root_barrier_kernel;
+class relaunch_kernel;
+
+/**
+ * @brief Device arrays exchanged between rounds; round r reads from
+ *        get_current(r) and writes to get_next(r)
+ */
+struct exchange_data {
+  int* a;
+  int* b;
+  size_t size;
+
+  int* get_current(size_t round) const { return round % 2 ? b : a; }
+  int* get_next(size_t round) const { return round % 2 ? a : b; }
+};
+
+/**
+ * @brief Times sample_count runs of \p run after a warm-up, resetting the
+ *        data before every run, and returns the statistics and the number of
+ *        wrong elements after the last run
+ */
+template <typename RunT>
+std::pair<benchmark::sample_stats, size_t> measure_rounds(
+    sycl::queue& queue, const exchange_data& data, RunT&& run) {
+  std::vector<int> values(data.size);
+  std::vector<double> samples;
+  for (size_t sample = 0; sample <= sample_count; ++sample) {
+    std::iota(values.begin(), values.end(), 0);
+    queue.memcpy(data.a, values.data(), data.size * sizeof(int))
+        .wait_and_throw();
+    const double ns = benchmark::time_ns([&] {
+      run();
+      queue.wait_and_throw();
+    });
+    if (sample > 0) samples.push_back(ns);
+  }
+  queue
+      .memcpy(values.data(), data.get_current(round_count),
+              data.size * sizeof(int))
+      .wait_and_throw();
+  size_t wrong = 0;
+  for (size_t i = 0; i < data.size; ++i)
+    wrong += values[i] != expected_value(i, data.size, round_count);
+  return {benchmark::get_stats(std::move(samples)), wrong};
+}
+
+/**
+ * @brief Returns the work-group counts measured: powers of two below
+ *        \p max_groups, then \p max_groups
+ */
+std::vector<size_t> get_group_counts(size_t max_groups) {
+  std::vector<size_t> counts;
+  for (size_t count = 1; count < max_groups; count *= 2)
+    counts.push_back(count);
+  counts.push_back(max_groups);
+  return counts;
+}
+
+#endif
+
+TEST_CASE("Root group barrier latency compared with kernel relaunches",
+          "[oneapi_root_group][perf]") {
+#ifndef SYCL_EXT_ONEAPI_ROOT_GROUP
+  SKIP("SYCL_EXT_ONEAPI_ROOT_GROUP is not defined");
+#else
+  const auto device = get_cts_object::device();
+  if (!device.has(sycl::aspect::usm_device_allocations)) {
+    SKIP("Device does not support USM device allocations");
+  }
+  // Relaunched rounds depend on each other
+  sycl::queue queue(device, {sycl::property::queue::in_order()});
+  auto bundle = sycl::get_kernel_bundle<sycl::bundle_state::executable>(
+      queue.get_context());
+  auto kernel = bundle.get_kernel<root_barrier_kernel>();
+  const size_t max_groups = kernel.ext_oneapi_get_info<
+      syclex::info::kernel_queue_specific::max_num_work_group_sync>(queue);
+  REQUIRE(max_groups >= 1);
+  const size_t local_size = std::min(
+      max_local_size,
+      device.get_info<sycl::info::device::max_work_group_size>());
+  const auto props = syclex::properties{syclex::use_root_sync};
+
+  std::optional<size_t> relaunch_wins_from;
+  for (size_t group_count : get_group_counts(max_groups)) {
+    const size_t size = group_count * local_size;
+    const sycl::nd_range<1> nd_range{sycl::range<1>{size},
+                                     sycl::range<1>{local_size}};
+    exchange_data data{sycl::malloc_device<int>(size, queue),
+                       sycl::malloc_device<int>(size, queue), size};
+    REQUIRE(data.a != nullptr);
+    REQUIRE(data.b != nullptr);
+    INFO(group_count << " work-group(s) of " << local_size);
+
+    const auto [cooperative, cooperative_wrong] =
+        measure_rounds(queue, data, [&] {
+          queue.parallel_for<root_barrier_kernel>(
+              nd_range, props, [=](sycl::nd_item<1> it) {
+                auto root = it.ext_oneapi_get_root_group();
+                const size_t i = root.get_local_linear_id();
+                for (size_t round = 0; round < round_count; ++round) {
+                  data.get_next(round)[i] =
+                      data.get_current(round)[(i + 1) % data.size] + 1;
+                  sycl::group_barrier(root);
+                }
+              });
+        });
+    const auto [relaunch, relaunch_wrong] =
+        measure_rounds(queue, data, [&] {
+          for (size_t round = 0; round < round_count; ++round) {
+            const int* current = data.get_current(round);
+            int* next = data.get_next(round);
+            queue.parallel_for<relaunch_kernel>(
+                nd_range, [=](sycl::nd_item<1> it) {
+                  const size_t i = it.get_global_linear_id();
+                  next[i] = current[(i + 1) % size] + 1;
+                });
+          }
+        });
+    sycl::free(data.a, queue);
+    sycl::free(data.b, queue);
+    CHECK(cooperative_wrong == 0);
+    CHECK(relaunch_wrong == 0);
+
+    const double barrier_ns = cooperative.p50 / round_count;
+    const double launch_ns = relaunch.p50 / round_count;
+    if (launch_ns < barrier_ns && !relaunch_wins_from)
+      relaunch_wins_from = group_count;
+    WARN("[perf] " << group_count << " work-group(s) of " << local_size
+                   << ": round with root group barrier "
+                   << benchmark::format_duration(barrier_ns)
+                   << ", round as a kernel launch "
+                   << benchmark::format_duration(launch_ns)
+                   << ", relaunching takes " << launch_ns / barrier_ns
+                   << "x the time");
+  }
+  if (relaunch_wins_from) {
+    WARN("[perf] relaunching beats root group barriers from "
+         << *relaunch_wins_from << " work-group(s) of " << local_size);
+  } else {
+    WARN("[perf] root group barriers beat relaunching up to "
+         << max_groups << " work-group(s) of " << local_size);
+  }
+#endif
+}
+
+}  // namespace root_group_perf
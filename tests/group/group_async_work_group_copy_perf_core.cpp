@@ -0,0 +1,34 @@
+/*******************************************************************************
+//
+//  SYCL 2020 Conformance Test Suite
+//
+//  Copyright (c) 2026 The Khronos Group Inc.
+//
+//  Licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//
+*******************************************************************************/
+
+#include "group_async_work_group_copy_throughput.h"
+
+namespace group_async_work_group_copy_perf_core {
+using namespace group_async_work_group_copy_throughput;
+
+using CoreTypes =
+    std::tuple<char, short, int, long long, float, sycl::vec<int, 4>>;
+
+TEMPLATE_LIST_TEST_CASE("group::async_work_group_copy throughput. core types",
+                        "[group][perf]", CoreTypes) {
+  measure_type<TestType>(type_name<TestType>());
+}
+
+}  // namespace group_async_work_group_copy_perf_core
@@ -0,0 +1,40 @@
+/*******************************************************************************
+//
+//  SYCL 2020 Conformance Test Suite
+//
+//  Copyright (c) 2026 The Khronos Group Inc.
+//
+//  Licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//
+*******************************************************************************/
+
+#include "group_async_work_group_copy_throughput.h"
+
+namespace group_async_work_group_copy_perf_fp64 {
+using namespace group_async_work_group_copy_throughput;
+
+using DoubleTypes = std::tuple<double, sycl::vec<double, 4>>;
+
+TEMPLATE_LIST_TEST_CASE("group::async_work_group_copy throughput. fp64 types",
+                        "[group][perf]", DoubleTypes) {
+  auto queue = once_per_unit::get_queue();
+  if (!queue.get_device().has(sycl::aspect::fp64)) {
+    WARN(
+        "Device does not support double precision floating point operations. "
+        "Skipping the test case.");
+    return;
+  }
+  measure_type<TestType>(type_name<TestType>());
+}
+
+}  // namespace group_async_work_group_copy_perf_fp64
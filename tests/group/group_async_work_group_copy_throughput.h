@@ -0,0 +1,180 @@
+/*******************************************************************************
+//
+//  SYCL 2020 Conformance Test Suite
+//
+//  Copyright (c) 2026 The Khronos Group Inc.
+//
+//  Licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//
+//  Provides throughput measurements for group::async_work_group_copy().
+//  Every work-group copies a large tile from global to local memory reading
+//  with a stride, then copies the tile back to global memory writing with the
+//  same stride. The same copies done by a cooperative loop over the
+//  work-items serve as the reference.
+//
+*******************************************************************************/
+
+#ifndef SYCL_CTS_GROUP_ASYNC_WORK_GROUP_COPY_THROUGHPUT_H
+#define SYCL_CTS_GROUP_ASYNC_WORK_GROUP_COPY_THROUGHPUT_H
+
+#include "../common/benchmark.h"
+#include "../common/common.h"
+#include "../common/once_per_unit.h"
+
+#include <catch2/catch_template_test_macros.hpp>
+
+namespace group_async_work_group_copy_throughput {
+using namespace sycl_cts::util;
+
+/** Local memory used by a single tile, bytes */
+constexpr size_t max_tile_bytes = 16 * 1024;
+
+/** Upper limit of the work-group size used for the measurements */
+constexpr size_t max_work_group_size = 256;
+
+/** Upper limit of the global memory touched by a single kernel, bytes */
+constexpr size_t max_global_bytes = 256 * 1024 * 1024;
+
+/** Global memory strides, in elements */
+constexpr size_t strides[] = {1, 2, 4, 16};
+
+enum class copy_method { async_work_group_copy, cooperative_loop };
+
+template <typename T, copy_method Method>
+class copy_kernel;
+
+template <typename T, copy_method Method>
+void run_copy(sycl::queue& queue, sycl::buffer<T, 1>& in_buf,
+              sycl::buffer<T, 1>& out_buf, size_t group_count,
+              size_t local_size, size_t tile, size_t stride) {
+  queue
+      .submit([&](sycl::handler& cgh) {
+        sycl::accessor in_acc{in_buf, cgh, sycl::read_write};
+        sycl::accessor out_acc{out_buf, cgh, sycl::read_write};
+        sycl::local_accessor<T, 1> local_acc{sycl::range<1>{tile}, cgh};
+        cgh.parallel_for<copy_kernel<T, Method>>(
+            sycl::nd_range<1>{group_count * local_size, local_size},
+            [=](sycl::nd_item<1> item) {
+              const auto group = item.get_group();
+              using difference_type =
+                  typename sycl::decorated_global_ptr<T>::difference_type;
+              const auto offset = static_cast<difference_type>(
+                  group.get_group_linear_id() * tile * stride);
+              constexpr auto decorated = sycl::access::decorated::yes;
+              auto in_ptr =
+                  in_acc.template get_multi_ptr<decorated>() + offset;
+              auto out_ptr =
+                  out_acc.template get_multi_ptr<decorated>() + offset;
+              auto local_ptr = local_acc.template get_multi_ptr<decorated>();
+
+              if constexpr (Method == copy_method::async_work_group_copy) {
+                auto to_local = group.async_work_group_copy(local_ptr, in_ptr,
+                                                            tile, stride);
+                group.wait_for(to_local);
+                auto to_global = group.async_work_group_copy(
+                    out_ptr, local_ptr, tile, stride);
+                group.wait_for(to_global);
+              } else {
+                const size_t lid = item.get_local_linear_id();
+                for (size_t i = lid; i < tile; i += local_size)
+                  local_ptr[i] = in_ptr[i * stride];
+                sycl::group_barrier(group);
+                for (size_t i = lid; i < tile; i += local_size)
+                  out_ptr[i * stride] = local_ptr[i];
+                sycl::group_barrier(group);
+              }
+            });
+      })
+      .wait_and_throw();
+}
+
+/**
+ * @brief Measures both copy methods for every stride
+ * @tparam T Type of data to copy
+ * @param type_name The string naming the type of data for logs
+ */
+template <typename T>
+void measure_type(const std::string& type_name) {
+  auto queue = once_per_unit::get_queue();
+  const auto device = queue.get_device();
+  const size_t local_size = std::min(
+      device.get_info<sycl::info::device::max_work_group_size>(),
+      max_work_group_size);
+  const size_t tile =
+      std::min<size_t>(max_tile_bytes,
+                       device.get_info<sycl::info::device::local_mem_size>() /
+                           2) /
+      sizeof(T);
+  if (tile == 0) {
+    WARN("Not enough local memory for " << type_name << ". Skipping.");
+    return;
+  }
+  const size_t max_global_bytes_for_device = std::min<size_t>(
+      max_global_bytes,
+      device.get_info<sycl::info::device::max_mem_alloc_size>());
+
+  for (size_t stride : strides) {
+    const size_t group_count =
+        std::max<size_t>(1, max_global_bytes_for_device /
+                                (tile * stride * sizeof(T)));
+    const size_t count = group_count * tile * stride;
+    std::vector<T> input(count);
+    for (size_t i = 0; i < count; ++i)
+      input[i] = value_operations::init<T>(static_cast<int>(i % 127));
+    sycl::buffer<T, 1> in_buf{input.data(), sycl::range<1>{count}};
+    sycl::buffer<T, 1> out_buf{sycl::range<1>{count}};
+    // Bytes moved from global to local memory and back again
+    const double bytes = 2.0 * group_count * tile * sizeof(T);
+
+    const std::string name = "T = " + type_name + ", stride " +
+                             std::to_string(stride) + ", " +
+                             std::to_string(group_count) + " tiles of " +
+                             std::to_string(tile * sizeof(T)) + " bytes";
+    INFO(name);
+
+    auto measure_method = [&](auto method_tag, const std::string& method_name) {
+      constexpr copy_method method = decltype(method_tag)::value;
+      {
+        sycl::host_accessor out_acc{out_buf, sycl::write_only};
+        std::fill(out_acc.begin(), out_acc.end(),
+                  value_operations::init<T>(-1));
+      }
+      const auto stats =
+          benchmark::measure(benchmark::default_sample_count, [&] {
+            run_copy<T, method>(queue, in_buf, out_buf, group_count,
+                                local_size, tile, stride);
+          });
+      benchmark::report(method_name + ", " + name, stats, bytes, "B");
+
+      sycl::host_accessor out_acc{out_buf, sycl::read_only};
+      size_t mismatches = 0;
+      for (size_t i = 0; i < count; i += stride)
+        mismatches += !check_equal_values(out_acc[i], input[i]);
+      CHECK(mismatches == 0);
+      return stats;
+    };
+    const auto async_stats = measure_method(
+        std::integral_constant<copy_method,
+                               copy_method::async_work_group_copy>{},
+        "async_work_group_copy");
+    const auto loop_stats = measure_method(
+        std::integral_constant<copy_method, copy_method::cooperative_loop>{},
+        "cooperative loop");
+    WARN("[perf] " << name << ": async_work_group_copy / cooperative loop = "
+                   << async_stats.p50 / loop_stats.p50);
+  }
+}
+
+}  // namespace group_async_work_group_copy_throughput
+
+#endif  // SYCL_CTS_GROUP_ASYNC_WORK_GROUP_COPY_THROUGHPUT_H
@@ -0,0 +1,230 @@
+/*******************************************************************************
+//
+//  SYCL 2020 Conformance Test Suite
+//
+//  Copyright (c) 2026 The Khronos Group Inc.
+//
+//  Licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//
+//  Measures per-operation latency and sustained throughput of sub-group
+//  shuffles (select_from_group, permute_group_by_xor, shift_group_left/right)
+//  and votes (any_of_group, all_of_group, none_of_group) for every sub-group
+//  size reported by the device. Each work-item runs a dependent chain of the
+//  operation, so the cost of one operation is the difference between a run
+//  with the chain and a run without it, divided by the chain length.
+//
+*******************************************************************************/
+
+#include "../common/benchmark.h"
+#include "group_functions_common.h"
+
+#include <utility>
+
+namespace group_sub_group_perf {
+using namespace sycl_cts::util;
+
+enum class sub_group_op : int {
+  select_from_group = 0,
+  permute_group_by_xor,
+  shift_group_left_right,
+  any_of_group,
+  all_of_group,
+  none_of_group,
+  op_count  // defines size, should be last
+};
+
+inline std::string get_op_name(sub_group_op op) {
+  switch (op) {
+    case sub_group_op::select_from_group:
+      return "select_from_group";
+    case sub_group_op::permute_group_by_xor:
+      return "permute_group_by_xor";
+    case sub_group_op::shift_group_left_right:
+      return "shift_group_left + shift_group_right";
+    case sub_group_op::any_of_group:
+      return "any_of_group";
+    case sub_group_op::all_of_group:
+      return "all_of_group";
+    case sub_group_op::none_of_group:
+      return "none_of_group";
+    default:
+      return "unknown";
+  }
+}
+
+/** Sub-group sizes the kernels are compiled for */
+using sub_group_sizes = std::index_sequence<4, 8, 16, 32, 64>;
+
+/** Length of the dependent operation chain; must be even, see kernel */
+constexpr size_t chain_length = 1024;
+
+/** Upper limit of the work-group size used for the measurements */
+constexpr size_t max_work_group_size = 256;
+
+template <typename T, size_t SGSize>
+class sub_group_op_kernel;
+
+/**
+ * @brief Runs chain of \p iterations operations \p op in every work-item and
+ *        stores whether the final value matches the expected one
+ */
+template <typename T, size_t SGSize>
+void run_chain(sycl::queue& queue, const sycl::nd_range<1>& range,
+               sycl::buffer<int, 1>& res_buf, sub_group_op op,
+               size_t iterations) {
+  queue
+      .submit([&](sycl::handler& cgh) {
+        sycl::accessor res_acc{res_buf, cgh, sycl::write_only, sycl::no_init};
+        cgh.parallel_for<sub_group_op_kernel<T, SGSize>>(
+            range,
+            [=](sycl::nd_item<1> item) [[sycl::reqd_sub_group_size(SGSize)]] {
+              sycl::sub_group sub_group = item.get_sub_group();
+              const size_t llid = sub_group.get_local_linear_id();
+              const size_t sg_size = sub_group.get_local_linear_range();
+
+              T value = splat_init<T>(llid);
+              size_t votes = 0;
+              bool ok = true;
+              switch (op) {
+                case sub_group_op::select_from_group:
+                  for (size_t i = 0; i < iterations; ++i)
+                    value = sycl::select_from_group(sub_group, value,
+                                                    (llid + 1) % sg_size);
+                  ok = equal(value,
+                             splat_init<T>((llid + iterations) % sg_size));
+                  break;
+                case sub_group_op::permute_group_by_xor:
+                  // Even number of xor-permutations restores the value
+                  for (size_t i = 0; i < iterations; ++i)
+                    value = sycl::permute_group_by_xor(sub_group, value, 1);
+                  ok = equal(value, splat_init<T>(llid));
+                  break;
+                case sub_group_op::shift_group_left_right:
+                  // Only the first work-item ends up with unspecified value
+                  for (size_t i = 0; i < iterations; i += 2) {
+                    value = sycl::shift_group_left(sub_group, value, 1);
+                    value = sycl::shift_group_right(sub_group, value, 1);
+                  }
+                  ok = (llid == 0) || equal(value, splat_init<T>(llid));
+                  break;
+                case sub_group_op::any_of_group:
+                  // Exactly one work-item votes true on every iteration
+                  for (size_t i = 0; i < iterations; ++i)
+                    votes += sycl::any_of_group(sub_group,
+                                                (llid + i) % sg_size == 0);
+                  ok = votes == iterations;
+                  break;
+                case sub_group_op::all_of_group:
+                  // One work-item votes false on every odd iteration
+                  for (size_t i = 0; i < iterations; ++i)
+                    votes += sycl::all_of_group(
+                        sub_group, i % 2 == 0 || llid != i % sg_size);
+                  ok = votes == iterations / 2;
+                  break;
+                case sub_group_op::none_of_group:
+                  // One work-item votes true on every odd iteration
+                  for (size_t i = 0; i < iterations; ++i)
+                    votes += sycl::none_of_group(
+                        sub_group, i % 2 == 1 && llid == i % sg_size);
+                  ok = votes == iterations / 2;
+                  break;
+                default:
+                  ok = false;
+              }
+              res_acc[item.get_global_linear_id()] = ok;
+            });
+      })
+      .wait_and_throw();
+}
+
+template <typename T, size_t SGSize>
+void measure_sub_group_size(sycl::queue& queue) {
+  const auto device = queue.get_device();
+  const size_t work_group_size =
+      std::min(device.get_info<sycl::info::device::max_work_group_size>(),
+               max_work_group_size) /
+      SGSize * SGSize;
+  if (work_group_size == 0) {
+    WARN("Sub-group size " << SGSize
+                           << " exceeds maximum work-group size. Skipping.");
+    return;
+  }
+  const size_t work_group_count =
+      4 * device.get_info<sycl::info::device::max_compute_units>();
+  const size_t global_size = work_group_count * work_group_size;
+  const sycl::nd_range<1> range{global_size, work_group_size};
+
+  std::vector<int> res(global_size, 0);
+  sycl::buffer<int, 1> res_buf{global_size};
+
+  for (int op_id = 0; op_id < to_integral(sub_group_op::op_count); ++op_id) {
+    const auto op = static_cast<sub_group_op>(op_id);
+    const std::string name = get_op_name(op) + " with T = " +
+                             type_name<T>() + ", sub-group size " +
+                             std::to_string(SGSize);
+    INFO(name);
+
+    const auto empty = benchmark::measure(
+        benchmark::default_sample_count,
+        [&] { run_chain<T, SGSize>(queue, range, res_buf, op, 0); });
+    const auto chain = benchmark::measure(
+        benchmark::default_sample_count, [&] {
+          run_chain<T, SGSize>(queue, range, res_buf, op, chain_length);
+        });
+
+    {
+      sycl::host_accessor res_acc{res_buf, sycl::read_only};
+      std::copy(res_acc.begin(), res_acc.end(), res.begin());
+    }
+    CHECK(std::all_of(res.begin(), res.end(), [](int ok) { return ok != 0; }));
+
+    const double chain_ns = std::max(chain.p50 - empty.p50, 0.0);
+    benchmark::report(name + ", kernel", chain);
+    WARN("[perf] " << name << ": latency "
+                   << benchmark::format_duration(chain_ns / chain_length)
+                   << " per operation, throughput "
+                   << benchmark::format_rate(
+                          static_cast<double>(global_size) * chain_length,
+                          chain_ns, "op"));
+  }
+}
+
+template <typename T, size_t... SGSizes>
+void measure_sub_group_sizes(sycl::queue& queue,
+                             std::index_sequence<SGSizes...>) {
+  const auto supported =
+      queue.get_device().get_info<sycl::info::device::sub_group_sizes>();
+  for (size_t size : supported) {
+    if (((size != SGSizes) && ...))
+      WARN("Sub-group size " << size
+                             << " is not covered by the benchmark. Skipping.");
+  }
+  auto is_supported = [&](size_t size) {
+    return std::find(supported.begin(), supported.end(), size) !=
+           supported.end();
+  };
+  ((is_supported(SGSizes) ? measure_sub_group_size<T, SGSizes>(queue)
+                          : void()),
+   ...);
+}
+
+using PerfTypes = std::tuple<char, int, float, unsigned long long int,
+                             sycl::vec<unsigned int, 4>>;
+
+TEMPLATE_LIST_TEST_CASE("Sub-group shuffle and vote performance",
+                        "[group_func][sub_group][perf]", PerfTypes) {
+  auto queue = once_per_unit::get_queue();
+  measure_sub_group_sizes<TestType>(queue, sub_group_sizes{});
+}
+
+}  // namespace group_sub_group_perf
@@ -0,0 +1,195 @@
+/*******************************************************************************
+//
+//  SYCL 2020 Conformance Test Suite
+//
+//  Copyright (c) 2026 The Khronos Group Inc.
+//
+//  Licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//
+//  Compares parallel_for_work_group / parallel_for_work_item kernels against
+//  equivalent nd_range kernels. Every kernel keeps an array of private values
+//  per work-item and updates it in several phases: in the hierarchical kernel
+//  each phase is a separate parallel_for_work_item call with an implicit
+//  barrier between them, in the nd_range kernel the phases are separated by
+//  group_barrier. The test scales the work-group count, the private_memory
+//  size and the number of phases; the difference between the one-phase and
+//  the many-phase runs gives the cost of a barrier.
+//
+*******************************************************************************/
+
+#include "../common/benchmark.h"
+#include "../common/common.h"
+#include "../common/once_per_unit.h"
+
+#include <array>
+
+namespace hierarchical_perf {
+using namespace sycl_cts::util;
+
+/** Upper limit of the work-group size used for the measurements */
+constexpr size_t max_local_size = 64;
+
+/** Number of phases used to estimate the barrier cost */
+constexpr size_t many_phases = 16;
+
+template <size_t PrivateSize>
+using private_block = std::array<size_t, PrivateSize>;
+
+template <size_t PrivateSize>
+class hierarchical_kernel;
+
+template <size_t PrivateSize>
+class nd_range_kernel;
+
+/**
+ * @brief Value the kernels are expected to write for a work-item
+ */
+template <size_t PrivateSize>
+size_t expected_value(size_t global_id, size_t phases) {
+  return PrivateSize * (global_id + phases - 1) +
+         PrivateSize * (PrivateSize - 1) / 2;
+}
+
+template <size_t PrivateSize>
+void run_hierarchical(sycl::queue& queue, sycl::buffer<size_t, 1>& out_buf,
+                      size_t group_count, size_t local_size, size_t phases) {
+  queue
+      .submit([&](sycl::handler& cgh) {
+        sycl::accessor out_acc{out_buf, cgh, sycl::write_only, sycl::no_init};
+        cgh.parallel_for_work_group<hierarchical_kernel<PrivateSize>>(
+            sycl::range<1>{group_count}, sycl::range<1>{local_size},
+            [=](sycl::group<1> group) {
+              sycl::private_memory<private_block<PrivateSize>, 1> priv(group);
+
+              group.parallel_for_work_item([&](sycl::h_item<1> item) {
+                const size_t global_id = item.get_global_id(0);
+                for (size_t i = 0; i < PrivateSize; ++i)
+                  priv(item)[i] = global_id + i;
+              });
+              for (size_t phase = 1; phase < phases; ++phase) {
+                group.parallel_for_work_item([&](sycl::h_item<1> item) {
+                  for (size_t i = 0; i < PrivateSize; ++i) ++priv(item)[i];
+                });
+              }
+              group.parallel_for_work_item([&](sycl::h_item<1> item) {
+                size_t sum = 0;
+                for (size_t i = 0; i < PrivateSize; ++i) sum += priv(item)[i];
+                out_acc[item.get_global_id(0)] = sum;
+              });
+            });
+      })
+      .wait_and_throw();
+}
+
+template <size_t PrivateSize>
+void run_nd_range(sycl::queue& queue, sycl::buffer<size_t, 1>& out_buf,
+                  size_t group_count, size_t local_size, size_t phases) {
+  queue
+      .submit([&](sycl::handler& cgh) {
+        sycl::accessor out_acc{out_buf, cgh, sycl::write_only, sycl::no_init};
+        cgh.parallel_for<nd_range_kernel<PrivateSize>>(
+            sycl::nd_range<1>{group_count * local_size, local_size},
+            [=](sycl::nd_item<1> item) {
+              const size_t global_id = item.get_global_id(0);
+              private_block<PrivateSize> priv;
+
+              for (size_t i = 0; i < PrivateSize; ++i)
+                priv[i] = global_id + i;
+              sycl::group_barrier(item.get_group());
+              for (size_t phase = 1; phase < phases; ++phase) {
+                for (size_t i = 0; i < PrivateSize; ++i) ++priv[i];
+                sycl::group_barrier(item.get_group());
+              }
+              size_t sum = 0;
+              for (size_t i = 0; i < PrivateSize; ++i) sum += priv[i];
+              out_acc[global_id] = sum;
+            });
+      })
+      .wait_and_throw();
+}
+
+template <size_t PrivateSize>
+void check_output(sycl::buffer<size_t, 1>& out_buf, size_t phases) {
+  sycl::host_accessor out_acc{out_buf, sycl::read_only};
+  size_t mismatches = 0;
+  for (size_t i = 0; i < out_acc.size(); ++i)
+    mismatches += out_acc[i] != expected_value<PrivateSize>(i, phases);
+  CHECK(mismatches == 0);
+}
+
+template <size_t PrivateSize>
+void measure_private_size(sycl::queue& queue) {
+  const auto device = queue.get_device();
+  const size_t local_size = std::min(
+      device.get_info<sycl::info::device::max_work_group_size>(),
+      max_local_size);
+  const size_t compute_units =
+      device.get_info<sycl::info::device::max_compute_units>();
+  const size_t group_counts[] = {1, compute_units, 4 * compute_units,
+                                 16 * compute_units};
+
+  for (size_t group_count : group_counts) {
+    sycl::buffer<size_t, 1> out_buf{group_count * local_size};
+    const std::string config =
+        "private_memory of " + std::to_string(PrivateSize) + " x size_t, " +
+        std::to_string(group_count) + " work-groups of " +
+        std::to_string(local_size);
+    INFO(config);
+
+    benchmark::sample_stats hierarchical[2];
+    benchmark::sample_stats nd_range[2];
+    const size_t phase_counts[2] = {1, many_phases};
+    for (int p = 0; p < 2; ++p) {
+      const size_t phases = phase_counts[p];
+      hierarchical[p] =
+          benchmark::measure(benchmark::default_sample_count, [&] {
+            run_hierarchical<PrivateSize>(queue, out_buf, group_count,
+                                          local_size, phases);
+          });
+      check_output<PrivateSize>(out_buf, phases);
+      nd_range[p] = benchmark::measure(benchmark::default_sample_count, [&] {
+        run_nd_range<PrivateSize>(queue, out_buf, group_count, local_size,
+                                  phases);
+      });
+      check_output<PrivateSize>(out_buf, phases);
+
+      const std::string name =
+          config + ", " + std::to_string(phases) + " phase(s)";
+      benchmark::report("parallel_for_work_group, " + name, hierarchical[p]);
+      benchmark::report("nd_range, " + name, nd_range[p]);
+      WARN("[perf] " << name << ": hierarchical / nd_range = "
+                     << hierarchical[p].p50 / nd_range[p].p50);
+    }
+
+    const auto barrier_cost = [](const benchmark::sample_stats& one,
+                                 const benchmark::sample_stats& many) {
+      return benchmark::format_duration(std::max(many.p50 - one.p50, 0.0) /
+                                        (many_phases - 1));
+    };
+    WARN("[perf] " << config << ": barrier cost per phase "
+                   << barrier_cost(hierarchical[0], hierarchical[1])
+                   << " (implicit) vs "
+                   << barrier_cost(nd_range[0], nd_range[1])
+                   << " (group_barrier)");
+  }
+}
+
+TEST_CASE("Hierarchical parallelism overhead compared to nd_range",
+          "[hierarchical][perf]") {
+  auto queue = once_per_unit::get_queue();
+  measure_private_size<1>(queue);
+  measure_private_size<16>(queue);
+  measure_private_size<64>(queue);
+}
+
+}  // namespace hierarchical_perf
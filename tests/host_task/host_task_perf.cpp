@@ -0,0 +1,292 @@
+/*******************************************************************************
+//
+//  SYCL 2020 Conformance Test Suite
+//
+//  Copyright (c) 2026 The Khronos Group Inc.
+//
+//  Licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//
+//  Measures host_task dispatch latency, the number of host tasks the runtime
+//  runs concurrently and how much host and device work overlaps in pipelines
+//  where every chunk of data is produced by a kernel and consumed by a
+//  host_task. Pipelines use both buffer accessors with target::host_task and
+//  USM pointers with explicit dependencies.
+//
+*******************************************************************************/
+
+#include "../common/benchmark.h"
+#include "../common/common.h"
+#include "../common/once_per_unit.h"
+
+#include <thread>
+
+namespace host_task_perf {
+using namespace sycl_cts::util;
+
+/** Number of host tasks run to measure the dispatch latency */
+constexpr size_t latency_samples = 1000;
+
+/** Number of independent host tasks used to detect concurrency */
+constexpr size_t concurrent_tasks = 32;
+
+/** Duration of every host task used to detect concurrency */
+constexpr auto concurrent_task_duration = std::chrono::milliseconds(10);
+
+/** Number of chunks in a pipeline */
+constexpr size_t chunk_count = 32;
+
+/** Number of elements of a chunk */
+constexpr size_t chunk_size = size_t{1} << 16;
+
+/** Number of timed runs of every pipeline configuration */
+constexpr size_t pipeline_samples = 10;
+
+/** Number of generator steps computed for every element */
+constexpr unsigned work_iterations = 256;
+
+/** Which commands of the pipeline are submitted */
+enum class pipeline_mode { device_only, host_only, both };
+
+/**
+ * @brief Value produced by the kernels and recomputed by the host tasks to
+ *        verify it, so device and host work are proportional
+ */
+inline unsigned work_value(size_t index, size_t chunk) {
+  unsigned value = static_cast<unsigned>(index * chunk_count + chunk);
+  for (unsigned i = 0; i < work_iterations; ++i)
+    value = value * 1103515245u + 12345u;
+  return value;
+}
+
+/**
+ * @brief Host part of the pipeline: counts elements of the chunk that differ
+ *        from the expected values
+ */
+template <typename DataT>
+size_t count_mismatches(const DataT& data, size_t chunk) {
+  size_t mismatches = 0;
+  for (size_t i = 0; i < chunk_size; ++i)
+    mismatches += data[i] != work_value(i, chunk);
+  return mismatches;
+}
+
+class produce_buffer_kernel;
+class produce_usm_kernel;
+
+/**
+ * @brief Runs the pipeline with a buffer per chunk; host tasks access the
+ *        buffers through target::host_task accessors
+ */
+double run_buffer_pipeline(sycl::queue& queue,
+                           std::vector<sycl::buffer<unsigned, 1>>& chunks,
+                           std::vector<size_t>& mismatches,
+                           pipeline_mode mode) {
+  return benchmark::time_ns([&] {
+    for (size_t chunk = 0; chunk < chunk_count; ++chunk) {
+      if (mode != pipeline_mode::host_only) {
+        queue.submit([&](sycl::handler& cgh) {
+          sycl::accessor acc{chunks[chunk], cgh, sycl::write_only,
+                             sycl::no_init};
+          cgh.parallel_for<produce_buffer_kernel>(
+              sycl::range<1>{chunk_size},
+              [=](sycl::id<1> i) { acc[i] = work_value(i[0], chunk); });
+        });
+      }
+      if (mode != pipeline_mode::device_only) {
+        queue.submit([&](sycl::handler& cgh) {
+          sycl::accessor<unsigned, 1, sycl::access_mode::read,
+                         sycl::target::host_task>
+              acc{chunks[chunk], cgh};
+          size_t* result = &mismatches[chunk];
+          cgh.host_task([=] { *result = count_mismatches(acc, chunk); });
+        });
+      }
+    }
+    queue.wait_and_throw();
+  });
+}
+
+/**
+ * @brief Runs the pipeline with a USM allocation per chunk; host tasks depend
+ *        on the events of the kernels producing their chunks
+ */
+double run_usm_pipeline(sycl::queue& queue,
+                        const std::vector<unsigned*>& chunks,
+                        std::vector<size_t>& mismatches, pipeline_mode mode) {
+  return benchmark::time_ns([&] {
+    for (size_t chunk = 0; chunk < chunk_count; ++chunk) {
+      unsigned* data = chunks[chunk];
+      sycl::event produced;
+      if (mode != pipeline_mode::host_only) {
+        produced = queue.parallel_for<produce_usm_kernel>(
+            sycl::range<1>{chunk_size},
+            [=](sycl::id<1> i) { data[i] = work_value(i[0], chunk); });
+      }
+      if (mode != pipeline_mode::device_only) {
+        size_t* result = &mismatches[chunk];
+        queue.submit([&](sycl::handler& cgh) {
+          cgh.depends_on(produced);
+          cgh.host_task([=] { *result = count_mismatches(data, chunk); });
+        });
+      }
+    }
+    queue.wait_and_throw();
+  });
+}
+
+/**
+ * @brief Runs the pipeline with device work only, host work only and both,
+ *        and reports how much of the shorter part was hidden by overlapping
+ * @param run Callable taking pipeline_mode and returning the duration
+ */
+template <typename RunT>
+void measure_pipeline(const std::string& name, std::vector<size_t>& mismatches,
+                      RunT&& run) {
+  INFO(name);
+  auto measure_mode = [&](pipeline_mode mode) {
+    std::vector<double> samples;
+    for (size_t i = 0; i < pipeline_samples; ++i)
+      samples.push_back(run(mode));
+    return benchmark::get_stats(samples);
+  };
+  run(pipeline_mode::both);  // warm-up
+
+  const auto device = measure_mode(pipeline_mode::device_only);
+  const auto host = measure_mode(pipeline_mode::host_only);
+  std::fill(mismatches.begin(), mismatches.end(), chunk_size);
+  const auto both = measure_mode(pipeline_mode::both);
+  CHECK(std::all_of(mismatches.begin(), mismatches.end(),
+                    [](size_t count) { return count == 0; }));
+
+  benchmark::report(name + ", kernels only", device);
+  benchmark::report(name + ", host tasks only", host);
+  benchmark::report(name + ", interleaved", both);
+  const double hidden = std::max(device.p50 + host.p50 - both.p50, 0.0);
+  WARN("[perf] " << name << ": "
+                 << 100.0 * hidden / std::min(device.p50, host.p50)
+                 << "% of the shorter part overlapped");
+}
+
+class empty_kernel;
+
+TEST_CASE("host_task dispatch latency and concurrency", "[host_task][perf]") {
+  auto queue = once_per_unit::get_queue();
+
+  SECTION("dispatch latency") {
+    std::vector<double> latencies;
+    latencies.reserve(latency_samples);
+    for (size_t i = 0; i < latency_samples; ++i) {
+      benchmark::clock::time_point started;
+      const auto submitted = benchmark::clock::now();
+      queue.submit([&](sycl::handler& cgh) {
+        cgh.host_task([&] { started = benchmark::clock::now(); });
+      });
+      queue.wait_and_throw();
+      latencies.push_back(benchmark::elapsed_ns(submitted, started));
+    }
+    benchmark::report("host_task submit to start",
+                      benchmark::get_stats(latencies));
+
+    latencies.clear();
+    for (size_t i = 0; i < latency_samples; ++i) {
+      latencies.push_back(benchmark::time_ns([&] {
+        auto kernel_done = queue.single_task<empty_kernel>([] {});
+        queue.submit([&](sycl::handler& cgh) {
+          cgh.depends_on(kernel_done);
+          cgh.host_task([] {});
+        });
+        queue.wait_and_throw();
+      }));
+    }
+    benchmark::report("kernel followed by dependent host_task",
+                      benchmark::get_stats(latencies));
+  }
+
+  SECTION("concurrency") {
+    using interval =
+        std::pair<benchmark::clock::time_point, benchmark::clock::time_point>;
+    std::vector<interval> intervals(concurrent_tasks);
+    const double total_ns = benchmark::time_ns([&] {
+      for (auto& task_interval : intervals) {
+        queue.submit([&](sycl::handler& cgh) {
+          cgh.host_task([&task_interval] {
+            task_interval.first = benchmark::clock::now();
+            std::this_thread::sleep_for(concurrent_task_duration);
+            task_interval.second = benchmark::clock::now();
+          });
+        });
+      }
+      queue.wait_and_throw();
+    });
+
+    // Sweep over start and end points to find the maximum overlap
+    std::vector<std::pair<benchmark::clock::time_point, int>> points;
+    for (const auto& task_interval : intervals) {
+      points.emplace_back(task_interval.first, 1);
+      points.emplace_back(task_interval.second, -1);
+    }
+    std::sort(points.begin(), points.end());
+    int running = 0;
+    int max_running = 0;
+    for (const auto& point : points) {
+      running += point.second;
+      max_running = std::max(max_running, running);
+    }
+    WARN("[perf] " << concurrent_tasks << " independent host tasks of "
+                   << concurrent_task_duration.count() << " ms: at most "
+                   << max_running << " ran concurrently, total "
+                   << benchmark::format_duration(total_ns)
+                   << (max_running == 1 ? "; host tasks are serialized" : ""));
+  }
+}
+
+TEST_CASE("Overlap of host tasks and kernels in pipelines",
+          "[host_task][perf]") {
+  auto queue = once_per_unit::get_queue();
+  std::vector<size_t> mismatches(chunk_count);
+
+  SECTION("buffer accessors") {
+    std::vector<sycl::buffer<unsigned, 1>> chunks;
+    for (size_t chunk = 0; chunk < chunk_count; ++chunk)
+      chunks.emplace_back(sycl::range<1>{chunk_size});
+    measure_pipeline("pipeline with buffers", mismatches, [&](auto mode) {
+      return run_buffer_pipeline(queue, chunks, mismatches, mode);
+    });
+  }
+
+  SECTION("USM") {
+    const auto device = queue.get_device();
+    sycl::usm::alloc kind = sycl::usm::alloc::shared;
+    if (!device.has(sycl::aspect::usm_shared_allocations)) {
+      if (!device.has(sycl::aspect::usm_host_allocations)) {
+        SKIP("Device does not support USM shared and host allocations");
+      }
+      kind = sycl::usm::alloc::host;
+    }
+    std::vector<unsigned*> chunks;
+    for (size_t chunk = 0; chunk < chunk_count; ++chunk) {
+      chunks.push_back(sycl::malloc<unsigned>(chunk_size, queue, kind));
+      REQUIRE(chunks.back() != nullptr);
+    }
+    measure_pipeline(
+        std::string("pipeline with ") +
+            (kind == sycl::usm::alloc::shared ? "shared" : "host") +
+            " USM",
+        mismatches, [&](auto mode) {
+          return run_usm_pipeline(queue, chunks, mismatches, mode);
+        });
+    for (unsigned* chunk : chunks) sycl::free(chunk, queue);
+  }
+}
+
+}  // namespace host_task_perf
@@ -0,0 +1,456 @@
+/*******************************************************************************
+//
+//  SYCL 2020 Conformance Test Suite
+//
+//  Copyright (c) 2026 The Khronos Group Inc.
+//
+//  Licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//
+//  Measures image read and write throughput against buffers holding the
+//  same data. Every image_format is written and read through unsampled
+//  images in 1, 2 and 3 dimensions. Sampled images of every image_format are
+//  read with every valid combination of addressing, coordinate normalization
+//  and filtering mode; linear filtering is only used with the formats read
+//  as floating-point values. All results are read back and verified.
+//
+*******************************************************************************/
+
+#include "../common/benchmark.h"
+#include "../common/common.h"
+#include "../common/disabled_for_test_case.h"
+#include "../common/once_per_unit.h"
+
+#include <algorithm>
+#include <cmath>
+#include <optional>
+
+namespace image_perf {
+using namespace sycl_cts::util;
+
+/** Number of timed runs of every kernel */
+constexpr size_t sample_count = 5;
+
+#if !SYCL_CTS_COMPILING_WITH_HIPSYCL
+
+/**
+ * @brief Image format with the values used to fill it; channel c of texel i
+ *        holds ((i + c) % modulus) * scale, which is representable exactly
+ */
+struct format_info {
+  sycl::image_format format;
+  const char* name;
+  size_t texel_bytes;
+  unsigned modulus;
+  float scale;
+};
+
+constexpr format_info float_formats[] = {
+    {sycl::image_format::r8g8b8a8_unorm, "r8g8b8a8_unorm", 4, 256,
+     1.0f / 255},
+    {sycl::image_format::r16g16b16a16_unorm, "r16g16b16a16_unorm", 8, 65536,
+     1.0f / 65535},
+    {sycl::image_format::b8g8r8a8_unorm, "b8g8r8a8_unorm", 4, 256,
+     1.0f / 255},
+    {sycl::image_format::r16b16g16a16_sfloat, "r16b16g16a16_sfloat", 8, 2048,
+     1.0f},
+    {sycl::image_format::r32g32b32a32_sfloat, "r32g32b32a32_sfloat", 16,
+     1u << 24, 1.0f}};
+
+constexpr format_info int_formats[] = {
+    {sycl::image_format::r8g8b8a8_sint, "r8g8b8a8_sint", 4, 128, 1.0f},
+    {sycl::image_format::r16g16b16a16_sint, "r16g16b16a16_sint", 8, 32768,
+     1.0f},
+    {sycl::image_format::r32b32g32a32_sint, "r32b32g32a32_sint", 16, 1u << 30,
+     1.0f}};
+
+constexpr format_info uint_formats[] = {
+    {sycl::image_format::r8g8b8a8_uint, "r8g8b8a8_uint", 4, 256, 1.0f},
+    {sycl::image_format::r16g16b16a16_uint, "r16g16b16a16_uint", 8, 65536,
+     1.0f},
+    {sycl::image_format::r32b32g32a32_uint, "r32b32g32a32_uint", 16, 1u << 30,
+     1.0f}};
+
+/**
+ * @brief Value of texel \p index
+ */
+template <typename DataT>
+DataT make_value(size_t index, unsigned modulus, float scale) {
+  using element_t = typename DataT::element_type;
+  DataT result;
+  for (int c = 0; c < 4; ++c) {
+    const auto value = static_cast<unsigned>((index + c) % modulus);
+    if constexpr (std::is_floating_point_v<element_t>)
+      result[c] = static_cast<float>(value) * scale;
+    else
+      result[c] = static_cast<element_t>(value);
+  }
+  return result;
+}
+
+/**
+ * @brief Returns the image range for the kernel range \p range. The last
+ *        dimension of the kernel range varies fastest, so it is mapped to
+ *        the x coordinate.
+ */
+template <int Dims>
+sycl::range<Dims> get_image_range(const sycl::range<Dims>& range) {
+  if constexpr (Dims == 1)
+    return range;
+  else if constexpr (Dims == 2)
+    return {range[1], range[0]};
+  else
+    return {range[2], range[1], range[0]};
+}
+
+template <int Dims>
+auto get_int_coord(const sycl::id<Dims>& id) {
+  if constexpr (Dims == 1)
+    return static_cast<int>(id[0]);
+  else if constexpr (Dims == 2)
+    return sycl::int2(static_cast<int>(id[1]), static_cast<int>(id[0]));
+  else
+    return sycl::int4(static_cast<int>(id[2]), static_cast<int>(id[1]),
+                      static_cast<int>(id[0]), 0);
+}
+
+/**
+ * @brief Returns the coordinate of the center of the texel for \p id
+ */
+template <int Dims>
+auto get_float_coord(const sycl::id<Dims>& id, const sycl::range<Dims>& range,
+                     bool normalized) {
+  auto axis = [&](int dim) {
+    const float center = static_cast<float>(id[dim]) + 0.5f;
+    return normalized ? center / static_cast<float>(range[dim]) : center;
+  };
+  if constexpr (Dims == 1)
+    return axis(0);
+  else if constexpr (Dims == 2)
+    return sycl::float2(axis(1), axis(0));
+  else
+    return sycl::float4(axis(2), axis(1), axis(0), 0.0f);
+}
+
+/**
+ * @brief Returns a range of about a million texels within the device limits
+ */
+template <int Dims>
+sycl::range<Dims> get_range(const sycl::device& device) {
+  namespace info = sycl::info::device;
+  if constexpr (Dims == 1) {
+    const size_t width = device.get_info<info::image2d_max_width>();
+    return sycl::range<1>{std::min<size_t>(size_t{1} << 16, width)};
+  } else if constexpr (Dims == 2) {
+    const size_t width = device.get_info<info::image2d_max_width>();
+    const size_t height = device.get_info<info::image2d_max_height>();
+    return sycl::range<2>{std::min<size_t>(1024, height),
+                          std::min<size_t>(1024, width)};
+  } else {
+    const size_t width = device.get_info<info::image3d_max_width>();
+    const size_t height = device.get_info<info::image3d_max_height>();
+    const size_t depth = device.get_info<info::image3d_max_depth>();
+    return sycl::range<3>{std::min<size_t>(128, depth),
+                          std::min<size_t>(128, height),
+                          std::min<size_t>(128, width)};
+  }
+}
+
+/**
+ * @brief Returns the number of elements of \p buf differing from the texel
+ *        values by more than \p tolerance
+ */
+template <typename DataT, int Dims>
+size_t count_mismatches(sycl::buffer<DataT, Dims>& buf, const format_info& info,
+                        float tolerance) {
+  sycl::host_accessor acc{buf, sycl::read_only};
+  size_t mismatches = 0;
+  for (size_t i = 0; i < buf.size(); ++i) {
+    const DataT expected = make_value<DataT>(i, info.modulus, info.scale);
+    const DataT actual = acc.get_pointer()[i];
+    for (int c = 0; c < 4; ++c) {
+      const double diff = static_cast<double>(actual[c]) -
+                          static_cast<double>(expected[c]);
+      if (std::abs(diff) > tolerance) {
+        ++mismatches;
+        break;
+      }
+    }
+  }
+  return mismatches;
+}
+
+/**
+ * @brief Times a kernel submitted by \p submit and waits for it
+ */
+template <typename SubmitT>
+benchmark::sample_stats time_kernel(sycl::queue& queue, SubmitT&& submit) {
+  return benchmark::measure(sample_count, [&] {
+    submit();
+    queue.wait_and_throw();
+  });
+}
+
+void report_comparison(const std::string& name,
+                       const benchmark::sample_stats& image,
+                       const benchmark::sample_stats& buffer, double bytes) {
+  WARN("[perf] " << name << ": image "
+                 << benchmark::format_rate(bytes, image.p50, "B")
+                 << ", buffer "
+                 << benchmark::format_rate(bytes, buffer.p50, "B")
+                 << ", image / buffer time = " << image.p50 / buffer.p50);
+}
+
+template <typename DataT, int Dims>
+class image_write_kernel;
+template <typename DataT, int Dims>
+class image_read_kernel;
+template <typename DataT, int Dims>
+class buffer_write_kernel;
+template <typename DataT, int Dims>
+class buffer_read_kernel;
+
+/**
+ * @brief Measures writing and reading every texel of an unsampled image of
+ *        \p info against a buffer of the same data type
+ */
+template <typename DataT, int Dims>
+void measure_unsampled(sycl::queue& queue, const format_info& info) {
+  const auto range = get_range<Dims>(queue.get_device());
+  const std::string name =
+      std::string(info.name) + ", " + std::to_string(Dims) + "D";
+  INFO(name);
+  std::optional<sycl::unsampled_image<Dims>> image;
+  try {
+    image.emplace(info.format, get_image_range(range));
+  } catch (const sycl::exception& e) {
+    WARN("Skipping " << name << ": " << e.what());
+    return;
+  }
+  const unsigned modulus = info.modulus;
+  const float scale = info.scale;
+  const double bytes = static_cast<double>(range.size() * info.texel_bytes);
+  sycl::buffer<DataT, Dims> image_data{range};
+  sycl::buffer<DataT, Dims> buffer_data{range};
+  sycl::buffer<DataT, Dims> buffer_copy{range};
+
+  const auto image_write = time_kernel(queue, [&] {
+    queue.submit([&](sycl::handler& cgh) {
+      sycl::unsampled_image_accessor<DataT, Dims, sycl::access_mode::write>
+          acc{*image, cgh};
+      cgh.parallel_for<image_write_kernel<DataT, Dims>>(
+          range, [=](sycl::item<Dims> item) {
+            acc.write(get_int_coord(item.get_id()),
+                      make_value<DataT>(item.get_linear_id(), modulus, scale));
+          });
+    });
+  });
+  const auto image_read = time_kernel(queue, [&] {
+    queue.submit([&](sycl::handler& cgh) {
+      sycl::unsampled_image_accessor<DataT, Dims, sycl::access_mode::read>
+          acc{*image, cgh};
+      sycl::accessor out{image_data, cgh, sycl::write_only, sycl::no_init};
+      cgh.parallel_for<image_read_kernel<DataT, Dims>>(
+          range, [=](sycl::item<Dims> item) {
+            out[item] = acc.read(get_int_coord(item.get_id()));
+          });
+    });
+  });
+  const auto buffer_write = time_kernel(queue, [&] {
+    queue.submit([&](sycl::handler& cgh) {
+      sycl::accessor acc{buffer_data, cgh, sycl::write_only, sycl::no_init};
+      cgh.parallel_for<buffer_write_kernel<DataT, Dims>>(
+          range, [=](sycl::item<Dims> item) {
+            acc[item] = make_value<DataT>(item.get_linear_id(), modulus, scale);
+          });
+    });
+  });
+  const auto buffer_read = time_kernel(queue, [&] {
+    queue.submit([&](sycl::handler& cgh) {
+      sycl::accessor acc{buffer_data, cgh, sycl::read_only};
+      sycl::accessor out{buffer_copy, cgh, sycl::write_only, sycl::no_init};
+      cgh.parallel_for<buffer_read_kernel<DataT, Dims>>(
+          range, [=](sycl::item<Dims> item) { out[item] = acc[item]; });
+    });
+  });
+
+  // The values are exact in every format, up to the rounding of unorm
+  const float tolerance = info.scale < 1.0f ? info.scale / 4 : 0.0f;
+  CHECK(count_mismatches(image_data, info, tolerance) == 0);
+  CHECK(count_mismatches(buffer_copy, info, 0.0f) == 0);
+  report_comparison(name + ", write", image_write, buffer_write, bytes);
+  report_comparison(name + ", read", image_read, buffer_read, bytes);
+}
+
+template <int Dims>
+void measure_formats(sycl::queue& queue) {
+  for (const auto& info : float_formats)
+    measure_unsampled<sycl::float4, Dims>(queue, info);
+  for (const auto& info : int_formats)
+    measure_unsampled<sycl::int4, Dims>(queue, info);
+  for (const auto& info : uint_formats)
+    measure_unsampled<sycl::uint4, Dims>(queue, info);
+}
+
+std::string get_name(sycl::addressing_mode mode) {
+  switch (mode) {
+    case sycl::addressing_mode::mirrored_repeat:
+      return "mirrored_repeat";
+    case sycl::addressing_mode::repeat:
+      return "repeat";
+    case sycl::addressing_mode::clamp_to_edge:
+      return "clamp_to_edge";
+    case sycl::addressing_mode::clamp:
+      return "clamp";
+    default:
+      return "none";
+  }
+}
+
+template <typename DataT, int Dims>
+class sampled_read_kernel;
+template <int Dims>
+class sampled_buffer_read_kernel;
+
+/**
+ * @brief Measures reading every texel center of a sampled image of
+ *        \p format with \p sampler against reading a buffer
+ */
+template <typename DataT, int Dims>
+void measure_sampled(sycl::queue& queue, const format_info& format,
+                     const sycl::image_sampler& sampler,
+                     const benchmark::sample_stats& buffer_read) {
+  const auto range = get_range<Dims>(queue.get_device());
+  const bool normalized = sampler.coordinate ==
+                          sycl::coordinate_normalization_mode::normalized;
+  const bool linear = sampler.filtering == sycl::filtering_mode::linear;
+  const std::string name =
+      std::string(format.name) + ", " + std::to_string(Dims) + "D, " +
+      get_name(sampler.addressing) + ", " +
+      (normalized ? "normalized" : "unnormalized") + ", " +
+      (linear ? "linear" : "nearest");
+  INFO(name);
+
+  // Small values keep the error of linear filtering at texel centers low,
+  // even where the values wrap around between neighbouring texels
+  format_info info = format;
+  info.modulus = std::min(info.modulus, 64u);
+  std::vector<DataT> host_data(range.size());
+  for (size_t i = 0; i < host_data.size(); ++i)
+    host_data[i] = make_value<DataT>(i, info.modulus, info.scale);
+  std::optional<sycl::sampled_image<Dims>> image;
+  try {
+    image.emplace(host_data.data(), info.format, sampler,
+                  get_image_range(range));
+  } catch (const sycl::exception& e) {
+    WARN("Skipping " << name << ": " << e.what());
+    return;
+  }
+  sycl::buffer<DataT, Dims> out_data{range};
+
+  const auto image_read = time_kernel(queue, [&] {
+    queue.submit([&](sycl::handler& cgh) {
+      sycl::sampled_image_accessor<DataT, Dims> acc{*image, cgh};
+      sycl::accessor out{out_data, cgh, sycl::write_only, sycl::no_init};
+      cgh.parallel_for<sampled_read_kernel<DataT, Dims>>(
+          range, [=](sycl::item<Dims> item) {
+            out[item] = acc.read(
+                get_float_coord(item.get_id(), range, normalized));
+          });
+    });
+  });
+  // Far below the difference of scale between neighbouring texels, so
+  // reading the wrong texel or with a half texel offset is detected; unorm
+  // values may additionally be rounded
+  const float rounding = info.scale < 1.0f ? info.scale / 4 : 0.0f;
+  const float tolerance =
+      linear ? std::max(rounding, 1e-2f * info.scale) : rounding;
+  CHECK(count_mismatches(out_data, info, tolerance) == 0);
+  report_comparison(name, image_read, buffer_read,
+                    static_cast<double>(range.size() * info.texel_bytes));
+}
+
+template <int Dims>
+void measure_samplers(sycl::queue& queue) {
+  // Buffer equivalent of all sampled reads
+  const auto range = get_range<Dims>(queue.get_device());
+  sycl::buffer<sycl::float4, Dims> in_data{range};
+  sycl::buffer<sycl::float4, Dims> out_data{range};
+  {
+    sycl::host_accessor acc{in_data, sycl::write_only, sycl::no_init};
+    std::fill(acc.begin(), acc.end(), sycl::float4{1.0f});
+  }
+  const auto buffer_read = time_kernel(queue, [&] {
+    queue.submit([&](sycl::handler& cgh) {
+      sycl::accessor acc{in_data, cgh, sycl::read_only};
+      sycl::accessor out{out_data, cgh, sycl::write_only, sycl::no_init};
+      cgh.parallel_for<sampled_buffer_read_kernel<Dims>>(
+          range, [=](sycl::item<Dims> item) { out[item] = acc[item]; });
+    });
+  });
+
+  using sycl::addressing_mode;
+  using sycl::coordinate_normalization_mode;
+  for (auto addressing :
+       {addressing_mode::mirrored_repeat, addressing_mode::repeat,
+        addressing_mode::clamp_to_edge, addressing_mode::clamp,
+        addressing_mode::none}) {
+    for (auto coordinate : {coordinate_normalization_mode::normalized,
+                            coordinate_normalization_mode::unnormalized}) {
+      // Repeating modes require normalized coordinates
+      if (coordinate == coordinate_normalization_mode::unnormalized &&
+          (addressing == addressing_mode::mirrored_repeat ||
+           addressing == addressing_mode::repeat))
+        continue;
+      for (auto filtering :
+           {sycl::filtering_mode::nearest, sycl::filtering_mode::linear}) {
+        const sycl::image_sampler sampler{addressing, coordinate, filtering};
+        for (const auto& info : float_formats)
+          measure_sampled<sycl::float4, Dims>(queue, info, sampler,
+                                              buffer_read);
+        // Integer formats can only be read with nearest filtering
+        if (filtering == sycl::filtering_mode::linear) continue;
+        for (const auto& info : int_formats)
+          measure_sampled<sycl::int4, Dims>(queue, info, sampler, buffer_read);
+        for (const auto& info : uint_formats)
+          measure_sampled<sycl::uint4, Dims>(queue, info, sampler,
+                                             buffer_read);
+      }
+    }
+  }
+}
+
+#endif
+
+DISABLED_FOR_TEST_CASE(hipSYCL)
+("Unsampled image throughput by format", "[unsampled_image][perf]")({
+  auto queue = once_per_unit::get_queue();
+  if (!queue.get_device().has(sycl::aspect::image)) {
+    SKIP("Device does not support images");
+  }
+  measure_formats<1>(queue);
+  measure_formats<2>(queue);
+  measure_formats<3>(queue);
+});
+
+DISABLED_FOR_TEST_CASE(hipSYCL)
+("Sampled image throughput by sampler", "[sampled_image][perf]")({
+  auto queue = once_per_unit::get_queue();
+  if (!queue.get_device().has(sycl::aspect::image)) {
+    SKIP("Device does not support images");
+  }
+  measure_samplers<1>(queue);
+  measure_samplers<2>(queue);
+  measure_samplers<3>(queue);
+});
+
+}  // namespace image_perf
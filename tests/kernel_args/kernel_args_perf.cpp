@@ -0,0 +1,259 @@
+/*******************************************************************************
+//
+//  SYCL 2020 Conformance Test Suite
+//
+//  Copyright (c) 2026 The Khronos Group Inc.
+//
+//  Licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//
+//  Measures how the size of the kernel captures affects submission. Kernels
+//  capture a payload of every size of a ladder from 8 bytes to 32 KiB that
+//  fits into max_parameter_size, or a growing number of accessors or USM
+//  pointers. For every kernel the time of the submit call and of a submit and
+//  wait round trip are reported; the growth over the smallest capture shows
+//  the cost of copying the captures on submission and at kernel start.
+//
+*******************************************************************************/
+
+#include "../common/benchmark.h"
+#include "../common/common.h"
+#include "../common/once_per_unit.h"
+
+#include <algorithm>
+#include <array>
+#include <numeric>
+#include <utility>
+
+namespace kernel_args_perf {
+using namespace sycl_cts::util;
+
+/** Number of timed submit and wait round trips of every kernel */
+constexpr size_t round_trip_samples = 500;
+
+/** Number of submissions of every kernel issued back to back */
+constexpr size_t pipelined_submissions = 2000;
+
+/**
+ * Bytes of max_parameter_size left for the output accessor of the payload
+ * kernels; the size of an accessor on the device is not known on the host
+ */
+constexpr size_t reserved_bytes = 64;
+
+/**
+ * Payload sizes. Every power of two is preceded by the size leaving
+ * reserved_bytes under it, so limits that are powers of two are covered up
+ * to the limit and any other limit up to about half of it.
+ */
+constexpr size_t payload_sizes[] = {
+    8,    64,   256,  448,   512,   960,   1024,  1984,  2048,
+    4032, 4096, 8128, 8192, 16320, 16384, 32704, 32768};
+
+/**
+ * @brief Captured data of \p Bytes bytes
+ */
+template <size_t Bytes>
+struct payload {
+  std::array<unsigned, Bytes / sizeof(unsigned)> words;
+};
+
+/**
+ * @brief Median times of the submit call and of the round trip of a kernel
+ */
+struct launch_cost {
+  std::string name;
+  double submit_ns;
+  double round_trip_ns;
+};
+
+/**
+ * @brief Times round trips and back to back submissions of \p submit
+ * @param submit Callable submitting a single kernel
+ */
+template <typename SubmitT>
+launch_cost measure_launch(sycl::queue& queue, const std::string& name,
+                           SubmitT&& submit) {
+  INFO(name);
+  const auto round_trip = benchmark::measure(round_trip_samples, [&] {
+    submit();
+    queue.wait_and_throw();
+  });
+  std::vector<double> submit_ns;
+  submit_ns.reserve(pipelined_submissions);
+  for (size_t i = 0; i < pipelined_submissions; ++i)
+    submit_ns.push_back(benchmark::time_ns(submit));
+  queue.wait_and_throw();
+  const auto submit_stats = benchmark::get_stats(std::move(submit_ns));
+  benchmark::report(name + ", submit call", submit_stats);
+  benchmark::report(name + ", submit and wait", round_trip);
+  return {name, submit_stats.p50, round_trip.p50};
+}
+
+/**
+ * @brief Prints the costs relative to the first entry of \p costs
+ */
+void report_growth(const std::vector<launch_cost>& costs) {
+  if (costs.empty()) return;
+  const auto& base = costs.front();
+  for (const auto& cost : costs) {
+    WARN("[perf] " << cost.name << " vs " << base.name << ": submit call "
+                   << cost.submit_ns / base.submit_ns << "x, submit and wait "
+                   << cost.round_trip_ns / base.round_trip_ns << "x");
+  }
+}
+
+template <size_t Bytes>
+class capture_kernel;
+
+template <size_t Bytes>
+void measure_payload(sycl::queue& queue, size_t max_parameter_size,
+                     std::vector<launch_cost>& costs) {
+  if (Bytes + reserved_bytes > max_parameter_size) return;
+  const std::string name = "payload of " + std::to_string(Bytes) + " B";
+  payload<Bytes> data;
+  std::iota(data.words.begin(), data.words.end(), static_cast<unsigned>(Bytes));
+  const unsigned expected =
+      std::accumulate(data.words.begin(), data.words.end(), 0u);
+
+  unsigned result = 0;
+  {
+    sycl::buffer<unsigned, 1> buf{&result, sycl::range<1>{1}};
+    costs.push_back(measure_launch(queue, name, [&] {
+      queue.submit([&](sycl::handler& cgh) {
+        sycl::accessor acc{buf, cgh, sycl::write_only, sycl::no_init};
+        cgh.single_task<capture_kernel<Bytes>>([=] {
+          // Every word is read, so the whole payload has to be passed
+          unsigned sum = 0;
+          for (unsigned word : data.words) sum += word;
+          acc[0] = sum;
+        });
+      });
+    }));
+  }
+  CHECK(result == expected);
+}
+
+template <size_t... Is>
+void measure_payloads(sycl::queue& queue, size_t max_parameter_size,
+                      std::vector<launch_cost>& costs,
+                      std::index_sequence<Is...>) {
+  (measure_payload<payload_sizes[Is]>(queue, max_parameter_size, costs), ...);
+}
+
+template <size_t Count>
+class accessor_kernel;
+
+template <size_t Count, typename... AccessorT>
+void submit_accessor_kernel(sycl::handler& cgh, AccessorT... accessors) {
+  // Every accessor of the pack is captured separately
+  cgh.single_task<accessor_kernel<Count>>(
+      [=] { (static_cast<void>(accessors[0] += 1), ...); });
+}
+
+template <size_t... Is>
+void measure_accessors(sycl::queue& queue, std::vector<launch_cost>& costs,
+                       std::index_sequence<Is...>) {
+  constexpr size_t count = sizeof...(Is);
+  std::vector<unsigned> values(count, 0);
+  size_t launches = 0;
+  {
+    std::vector<sycl::buffer<unsigned, 1>> buffers;
+    for (auto& value : values) buffers.emplace_back(&value, sycl::range<1>{1});
+    costs.push_back(
+        measure_launch(queue, std::to_string(count) + " accessor(s)", [&] {
+          ++launches;
+          queue.submit([&](sycl::handler& cgh) {
+            submit_accessor_kernel<count>(
+                cgh, sycl::accessor{buffers[Is], cgh, sycl::read_write}...);
+          });
+        }));
+  }
+  CHECK(std::all_of(values.begin(), values.end(),
+                    [&](unsigned value) { return value == launches; }));
+}
+
+template <size_t Count>
+class pointer_kernel;
+
+template <size_t Count, typename... PointerT>
+void submit_pointer_kernel(sycl::handler& cgh, PointerT... pointers) {
+  cgh.single_task<pointer_kernel<Count>>(
+      [=] { (static_cast<void>(*pointers += 1), ...); });
+}
+
+template <size_t... Is>
+void measure_pointers(sycl::queue& queue, std::vector<launch_cost>& costs,
+                      std::index_sequence<Is...>) {
+  constexpr size_t count = sizeof...(Is);
+  unsigned* data = sycl::malloc_device<unsigned>(count, queue);
+  REQUIRE(data != nullptr);
+  queue.memset(data, 0, count * sizeof(unsigned)).wait_and_throw();
+  size_t launches = 0;
+  costs.push_back(
+      measure_launch(queue, std::to_string(count) + " USM pointer(s)", [&] {
+        ++launches;
+        queue.submit([&](sycl::handler& cgh) {
+          submit_pointer_kernel<count>(cgh, (data + Is)...);
+        });
+      }));
+  std::vector<unsigned> values(count);
+  queue.memcpy(values.data(), data, count * sizeof(unsigned)).wait_and_throw();
+  sycl::free(data, queue);
+  CHECK(std::all_of(values.begin(), values.end(),
+                    [&](unsigned value) { return value == launches; }));
+}
+
+TEST_CASE("Submission cost by kernel capture size", "[kernel_args][perf]") {
+  auto queue = once_per_unit::get_queue();
+  const auto device = queue.get_device();
+
+  SECTION("captured payload size") {
+    const size_t max_parameter_size =
+        device.get_info<sycl::info::device::max_parameter_size>();
+    std::vector<launch_cost> costs;
+    measure_payloads(
+        queue, max_parameter_size, costs,
+        std::make_index_sequence<std::size(payload_sizes)>{});
+    if (costs.empty()) {
+      SKIP("max_parameter_size of " << max_parameter_size
+                                    << " B is too small for any payload");
+    }
+    WARN("[perf] max_parameter_size " << max_parameter_size
+                                      << " B, largest payload measured: "
+                                      << costs.back().name);
+    report_growth(costs);
+  }
+
+  SECTION("number of accessors") {
+    std::vector<launch_cost> costs;
+    measure_accessors(queue, costs, std::make_index_sequence<1>{});
+    measure_accessors(queue, costs, std::make_index_sequence<4>{});
+    measure_accessors(queue, costs, std::make_index_sequence<16>{});
+    report_growth(costs);
+  }
+
+  SECTION("number of USM pointers") {
+    if (!device.has(sycl::aspect::usm_device_allocations)) {
+      SKIP("Device does not support USM device allocations");
+    }
+    // Kernels increment the same memory, so they must not run concurrently
+    sycl::queue in_order_queue(device, {sycl::property::queue::in_order()});
+    std::vector<launch_cost> costs;
+    measure_pointers(in_order_queue, costs, std::make_index_sequence<1>{});
+    measure_pointers(in_order_queue, costs, std::make_index_sequence<4>{});
+    measure_pointers(in_order_queue, costs, std::make_index_sequence<16>{});
+    measure_pointers(in_order_queue, costs, std::make_index_sequence<64>{});
+    report_growth(costs);
+  }
+}
+
+}  // namespace kernel_args_perf
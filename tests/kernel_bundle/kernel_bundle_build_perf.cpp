@@ -0,0 +1,211 @@
+/*******************************************************************************
+//
+//  SYCL 2020 Conformance Test Suite
+//
+//  Copyright (c) 2026 The Khronos Group Inc.
+//
+//  Licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//
+//  Times sycl::get_kernel_bundle, sycl::compile, sycl::link, sycl::build and
+//  sycl::join on bundles of 1, 10, 100 and 1000 kernels. Every bundle size
+//  uses its own kernels, so the first call of an operation is not served by
+//  work done for a smaller bundle. The first call is compared with repeated
+//  calls on the same bundle to detect the in-memory program cache; running
+//  the test executable twice shows the effect of a persistent cache on the
+//  first calls. The test is built as its own executable, so no other test
+//  warms up the caches.
+//
+*******************************************************************************/
+
+#include "../common/benchmark.h"
+#include "../common/common.h"
+#include "kernels.h"
+
+#include <algorithm>
+#include <utility>
+
+namespace kernel_bundle_build_perf {
+using namespace sycl_cts::util;
+
+/** Number of repeated calls of every operation on the same bundle */
+constexpr size_t repeat_count = 5;
+
+/** Repeated calls faster than the first one by this factor hit a cache */
+constexpr double cache_hit_ratio = 2.0;
+
+/**
+ * @brief Kernel following the kernels.h pattern, one distinct kernel per \p Id
+ */
+template <size_t Id>
+struct generated_kernel : kernels::kernel_base {
+  using kernels::kernel_base::kernel_base;
+
+  void operator()(sycl::item<1> item) const { trigger_invocation_flag(item); }
+};
+
+using element_type = kernels::kernel_base::element_type;
+
+/**
+ * @brief Returns ids of the kernels Offset + Ids
+ */
+template <size_t Offset, size_t... Ids>
+std::vector<sycl::kernel_id> get_ids(std::index_sequence<Ids...>) {
+  return {sycl::get_kernel_id<generated_kernel<Offset + Ids>>()...};
+}
+
+/**
+ * @brief Submits \p KernelT from \p bundle writing its flag to \p buf
+ */
+template <typename KernelT>
+void submit_kernel(
+    sycl::queue& queue,
+    const sycl::kernel_bundle<sycl::bundle_state::executable>& bundle,
+    sycl::buffer<element_type, 1>& buf) {
+  queue.submit([&](sycl::handler& cgh) {
+    cgh.use_kernel_bundle(bundle);
+    kernels::kernel_base::accessor_t acc{buf, cgh};
+    cgh.parallel_for<KernelT>(sycl::range<1>{1}, KernelT{acc});
+  });
+}
+
+/**
+ * @brief Runs the kernels Offset + Ids from \p bundle and returns the number
+ *        of kernels that were not invoked
+ */
+template <size_t Offset, size_t... Ids>
+size_t run_kernels(
+    sycl::queue& queue,
+    const sycl::kernel_bundle<sycl::bundle_state::executable>& bundle,
+    std::index_sequence<Ids...>) {
+  std::vector<element_type> results(sizeof...(Ids),
+                                    kernels::kernel_base::init_val);
+  {
+    std::vector<sycl::buffer<element_type, 1>> buffers;
+    for (auto& result : results)
+      buffers.emplace_back(&result, sycl::range<1>{1});
+    // Array initialization avoids the nesting limit of fold expressions
+    const int expand[] = {(submit_kernel<generated_kernel<Offset + Ids>>(
+                               queue, bundle, buffers[Ids]),
+                           0)...};
+    static_cast<void>(expand);
+    queue.wait_and_throw();
+  }
+  return std::count_if(results.begin(), results.end(), [](element_type v) {
+    return v != kernels::kernel_base::expected_val;
+  });
+}
+
+/**
+ * @brief Times the first call of \p action and repeated calls, and reports
+ *        whether repeated calls are served by a cache
+ * @retval Result of the first call
+ */
+template <typename ActionT>
+auto measure_first_and_repeat(const std::string& name, size_t kernel_count,
+                              ActionT&& action) {
+  const auto started = benchmark::clock::now();
+  auto result = action();
+  const double first_ns =
+      benchmark::elapsed_ns(started, benchmark::clock::now());
+  const auto repeat = benchmark::measure(repeat_count, [&] {
+    static_cast<void>(action());
+  });
+  WARN("[perf] " << name << ", " << kernel_count << " kernels: first call "
+                 << benchmark::format_duration(first_ns) << ", repeated p50 "
+                 << benchmark::format_duration(repeat.p50) << ", first / "
+                 << "repeated = " << first_ns / repeat.p50
+                 << (first_ns >= cache_hit_ratio * repeat.p50
+                         ? "; repeated calls hit a cache"
+                         : "; no cache hit detected"));
+  return result;
+}
+
+/**
+ * @brief Measures every operation on the kernels Offset .. Offset + Count - 1
+ */
+template <size_t Offset, size_t Count>
+void measure_bundle_size(sycl::queue& queue) {
+  using sequence = std::make_index_sequence<Count>;
+  const auto context = queue.get_context();
+  const auto device = queue.get_device();
+  const std::vector<sycl::device> devices{device};
+  const auto ids = get_ids<Offset>(sequence{});
+  INFO("bundle of " << Count << " kernels");
+
+  // The input path goes first, as getting an executable bundle may build the
+  // device images sycl::build would otherwise build from scratch
+  if (sycl::has_kernel_bundle<sycl::bundle_state::input>(context, devices,
+                                                         ids)) {
+    const auto input = measure_first_and_repeat(
+        "get_kernel_bundle<input>", Count, [&] {
+          return sycl::get_kernel_bundle<sycl::bundle_state::input>(
+              context, devices, ids);
+        });
+    if (device.has(sycl::aspect::online_compiler)) {
+      const auto object = measure_first_and_repeat(
+          "sycl::compile", Count, [&] { return sycl::compile(input); });
+      if (device.has(sycl::aspect::online_linker)) {
+        const auto linked = measure_first_and_repeat(
+            "sycl::link", Count, [&] { return sycl::link(object); });
+        CHECK(run_kernels<Offset>(queue, linked, sequence{}) == 0);
+      }
+    } else {
+      WARN("Device does not have sycl::aspect::online_compiler, "
+           "sycl::compile is not measured");
+    }
+    if (device.has(sycl::aspect::online_linker)) {
+      const auto built = measure_first_and_repeat(
+          "sycl::build", Count, [&] { return sycl::build(input); });
+      CHECK(run_kernels<Offset>(queue, built, sequence{}) == 0);
+    } else {
+      WARN("Device does not have sycl::aspect::online_linker, sycl::link "
+           "and sycl::build are not measured");
+    }
+  } else {
+    WARN("No kernel bundle in input state, sycl::compile, sycl::link and "
+         "sycl::build are not measured");
+  }
+
+  const auto executable = measure_first_and_repeat(
+      "get_kernel_bundle<executable>", Count, [&] {
+        return sycl::get_kernel_bundle<sycl::bundle_state::executable>(
+            context, devices, ids);
+      });
+  CHECK(run_kernels<Offset>(queue, executable, sequence{}) == 0);
+
+  // A bundle per kernel, joined into one
+  std::vector<sycl::kernel_bundle<sycl::bundle_state::executable>> parts;
+  const double split_ns = benchmark::time_ns([&] {
+    for (const auto& id : ids)
+      parts.push_back(sycl::get_kernel_bundle<sycl::bundle_state::executable>(
+          context, devices, {id}));
+  });
+  WARN("[perf] get_kernel_bundle<executable> of every kernel separately, "
+       << Count << " kernels: " << benchmark::format_duration(split_ns));
+  const auto joined = measure_first_and_repeat(
+      "sycl::join of single kernel bundles", Count,
+      [&] { return sycl::join(parts); });
+  CHECK(run_kernels<Offset>(queue, joined, sequence{}) == 0);
+}
+
+TEST_CASE("Latency of kernel bundle operations by bundle size",
+          "[kernel_bundle][perf]") {
+  auto queue = get_cts_object::queue();
+  // Bundles of 1, 10, 100 and 1000 kernels with disjoint kernel ids
+  measure_bundle_size<0, 1>(queue);
+  measure_bundle_size<1, 10>(queue);
+  measure_bundle_size<11, 100>(queue);
+  measure_bundle_size<111, 1000>(queue);
+}
+
+}  // namespace kernel_bundle_build_perf
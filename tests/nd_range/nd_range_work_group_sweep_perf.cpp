@@ -0,0 +1,95 @@
+/*******************************************************************************
+//
+//  SYCL 2020 Conformance Test Suite
+//
+//  Copyright (c) 2026 The Khronos Group Inc.
+//
+//  Licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//
+//  Runs a memory-bound nd_range kernel over every legal work-group range of
+//  the device and prints the resulting tuning table.
+//
+*******************************************************************************/
+
+#include "../common/common.h"
+#include "../common/once_per_unit.h"
+#include "../common/work_group_sweep.h"
+
+namespace nd_range_work_group_sweep_perf {
+using namespace sycl_cts::util;
+
+/** Number of timed runs for every work-group range */
+constexpr size_t sample_count = 10;
+
+template <int Dimensions>
+class axpy_kernel;
+
+template <int Dimensions>
+void sweep_axpy(sycl::queue& queue, const sycl::range<Dimensions>& global) {
+  constexpr float a = 2.0f;
+  const size_t count = global.size();
+  std::vector<float> x(count);
+  std::vector<float> y(count);
+  for (size_t i = 0; i < count; ++i) {
+    x[i] = static_cast<float>(i % 1024);
+    y[i] = static_cast<float>(i % 7);
+  }
+  sycl::buffer<float, 1> x_buf{x.data(), sycl::range<1>{count}};
+  sycl::buffer<float, 1> y_buf{y.data(), sycl::range<1>{count}};
+  sycl::buffer<float, 1> out_buf{sycl::range<1>{count}};
+
+  auto run = [&](const sycl::nd_range<Dimensions>& range) {
+    queue
+        .submit([&](sycl::handler& cgh) {
+          sycl::accessor x_acc{x_buf, cgh, sycl::read_only};
+          sycl::accessor y_acc{y_buf, cgh, sycl::read_only};
+          sycl::accessor out_acc{out_buf, cgh, sycl::write_only,
+                                 sycl::no_init};
+          cgh.parallel_for<axpy_kernel<Dimensions>>(
+              range, [=](sycl::nd_item<Dimensions> item) {
+                const size_t i = item.get_global_linear_id();
+                out_acc[i] = a * x_acc[i] + y_acc[i];
+              });
+        })
+        .wait_and_throw();
+  };
+
+  const auto result =
+      sweep_work_group_size<axpy_kernel<Dimensions>>(queue, global, run,
+                                                     sample_count);
+  REQUIRE_FALSE(result.table.empty());
+  report_work_group_sweep(queue,
+                          "axpy " + work_group_print(global) + " floats",
+                          result);
+
+  sycl::host_accessor out_acc{out_buf, sycl::read_only};
+  size_t mismatches = 0;
+  for (size_t i = 0; i < count; ++i)
+    mismatches += out_acc[i] != a * x[i] + y[i];
+  CHECK(mismatches == 0);
+}
+
+TEST_CASE("Work-group size sweep of an nd_range kernel",
+          "[nd_range][perf]") {
+  auto queue = once_per_unit::get_queue();
+
+  SECTION("1 dimension") { sweep_axpy<1>(queue, sycl::range<1>{1 << 22}); }
+  SECTION("2 dimensions") {
+    sweep_axpy<2>(queue, sycl::range<2>{2048, 2048});
+  }
+  SECTION("3 dimensions") {
+    sweep_axpy<3>(queue, sycl::range<3>{128, 128, 256});
+  }
+}
+
+}  // namespace nd_range_work_group_sweep_perf
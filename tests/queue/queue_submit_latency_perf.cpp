@@ -0,0 +1,125 @@
+/*******************************************************************************
+//
+//  SYCL 2020 Conformance Test Suite
+//
+//  Copyright (c) 2026 The Khronos Group Inc.
+//
+//  Licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//
+//  Measures the latency of submitting empty kernels through queue::submit
+//  and the queue shortcuts, and of the USM memcpy, memset and fill
+//  shortcuts, for in-order and out-of-order queues, with and without
+//  discard_events, and with and without a dependency on the previous command.
+//
+*******************************************************************************/
+
+#include "../common/submission_benchmark.h"
+
+namespace queue_submit_latency_perf {
+using namespace sycl_cts::util;
+
+template <int Id>
+class empty_kernel;
+
+/**
+ * @brief Measures every submission API on \p queue
+ * @param with_dependency Whether every command depends on the event of the
+ *        previous one
+ */
+void measure_queue(sycl::queue& queue, const std::string& queue_name,
+                   bool with_dependency) {
+  const std::string config =
+      queue_name + (with_dependency ? ", depends on previous" : "");
+  sycl::event last;
+  const sycl::range<1> range{1};
+
+  benchmark::measure_submission(
+      queue, "queue::submit single_task, " + config, [&] {
+        last = queue.submit([&](sycl::handler& cgh) {
+          if (with_dependency) cgh.depends_on(last);
+          cgh.single_task<empty_kernel<0>>([] {});
+        });
+      });
+  benchmark::measure_submission(
+      queue, "queue::submit parallel_for, " + config, [&] {
+        last = queue.submit([&](sycl::handler& cgh) {
+          if (with_dependency) cgh.depends_on(last);
+          cgh.parallel_for<empty_kernel<1>>(range, [](sycl::item<1>) {});
+        });
+      });
+  benchmark::measure_submission(queue, "queue::single_task, " + config, [&] {
+    last = with_dependency ? queue.single_task<empty_kernel<2>>(last, [] {})
+                           : queue.single_task<empty_kernel<3>>([] {});
+  });
+  benchmark::measure_submission(queue, "queue::parallel_for, " + config, [&] {
+    last = with_dependency
+               ? queue.parallel_for<empty_kernel<4>>(range, last,
+                                                     [](sycl::item<1>) {})
+               : queue.parallel_for<empty_kernel<5>>(range,
+                                                     [](sycl::item<1>) {});
+  });
+  benchmark::measure_submission(
+      queue, "queue::submit host_task, " + config, [&] {
+        last = queue.submit([&](sycl::handler& cgh) {
+          if (with_dependency) cgh.depends_on(last);
+          cgh.host_task([] {});
+        });
+      });
+
+  if (!queue.get_device().has(sycl::aspect::usm_device_allocations)) return;
+  int* data = sycl::malloc_device<int>(2, queue);
+  REQUIRE(data != nullptr);
+  benchmark::measure_submission(queue, "queue::memcpy, " + config, [&] {
+    last = with_dependency ? queue.memcpy(data, data + 1, sizeof(int), last)
+                           : queue.memcpy(data, data + 1, sizeof(int));
+  });
+  benchmark::measure_submission(queue, "queue::memset, " + config, [&] {
+    last = with_dependency ? queue.memset(data, 0, sizeof(int), last)
+                           : queue.memset(data, 0, sizeof(int));
+  });
+  benchmark::measure_submission(queue, "queue::fill, " + config, [&] {
+    last = with_dependency ? queue.fill(data, 1, 1, last)
+                           : queue.fill(data, 1, 1);
+  });
+  queue.wait_and_throw();
+  sycl::free(data, queue);
+}
+
+TEST_CASE("Kernel submission latency", "[queue][perf]") {
+  SECTION("out-of-order queue") {
+    auto queue = benchmark::make_queue({});
+    measure_queue(queue, "out-of-order queue", false);
+    measure_queue(queue, "out-of-order queue", true);
+  }
+  SECTION("in-order queue") {
+    auto queue = benchmark::make_queue({sycl::property::queue::in_order{}});
+    measure_queue(queue, "in-order queue", false);
+    measure_queue(queue, "in-order queue", true);
+  }
+#ifdef SYCL_EXT_ONEAPI_DISCARD_QUEUE_EVENTS
+  // Dependencies need events, so they are not measured with discard_events
+  SECTION("out-of-order queue with discard_events") {
+    auto queue = benchmark::make_queue(
+        {sycl::ext::oneapi::property::queue::discard_events{}});
+    measure_queue(queue, "out-of-order queue, discard_events", false);
+  }
+  SECTION("in-order queue with discard_events") {
+    auto queue = benchmark::make_queue(
+        {sycl::ext::oneapi::property::queue::discard_events{},
+         sycl::property::queue::in_order{}});
+    measure_queue(queue, "in-order queue, discard_events", false);
+  }
+#endif  // SYCL_EXT_ONEAPI_DISCARD_QUEUE_EVENTS
+}
+
+}  // namespace queue_submit_latency_perf
@@ -0,0 +1,236 @@
+/*******************************************************************************
+//
+//  SYCL 2020 Conformance Test Suite
+//
+//  Copyright (c) 2026 The Khronos Group Inc.
+//
+//  Licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//
+//  Measures the cost of changing specialization constant values. A kernel
+//  whose loop trip count is a specialization constant is rebuilt for a
+//  number of values through set_specialization_constant and sycl::build, and
+//  through handler::set_specialization_constant. Every value is visited
+//  twice to detect whether previously built variants are cached. The runtime
+//  of the specialized kernel is compared with the same kernel taking the
+//  trip count as a kernel argument.
+//
+*******************************************************************************/
+
+#include "../common/benchmark.h"
+#include "../common/common.h"
+#include "../common/once_per_unit.h"
+
+namespace spec_constants_perf {
+using namespace sycl_cts::util;
+
+/** Number of distinct values given to the specialization constant */
+constexpr size_t variant_count = 16;
+
+/** Number of work items of every kernel */
+constexpr size_t element_count = size_t{1} << 20;
+
+/** Number of timed runs comparing specialized and runtime trip counts */
+constexpr size_t runtime_samples = 20;
+
+/** Repeated builds faster than the first ones by this factor hit a cache */
+constexpr double cache_hit_ratio = 2.0;
+
+constexpr int default_iterations = 1;
+
+constexpr sycl::specialization_id<int> iterations_id(default_iterations);
+
+/**
+ * @brief Value of the specialization constant for variant \p variant
+ */
+int get_iterations(size_t variant) { return static_cast<int>(8 * variant + 8); }
+
+/**
+ * @brief Computation of every work item; the trip count is known at compile
+ *        time of a specialized kernel
+ */
+inline unsigned transform(unsigned value, int iterations) {
+  for (int i = 0; i < iterations; ++i) value = value * 1664525u + 1013904223u;
+  return value;
+}
+
+class specialized_kernel;
+class runtime_kernel;
+
+/**
+ * @brief Runs the kernel reading the trip count from the specialization
+ *        constant and waits for it
+ * @param setup Callable taking sycl::handler& that sets the value or the
+ *        kernel bundle to use
+ */
+template <typename SetupT>
+void run_specialized(sycl::queue& queue, sycl::buffer<unsigned, 1>& buf,
+                     SetupT&& setup) {
+  queue.submit([&](sycl::handler& cgh) {
+    setup(cgh);
+    sycl::accessor acc{buf, cgh, sycl::write_only, sycl::no_init};
+    cgh.parallel_for<specialized_kernel>(
+        sycl::range<1>{element_count},
+        [=](sycl::item<1> item, sycl::kernel_handler h) {
+          const int iterations =
+              h.get_specialization_constant<iterations_id>();
+          acc[item] = transform(static_cast<unsigned>(item[0]), iterations);
+        });
+  });
+  queue.wait_and_throw();
+}
+
+/**
+ * @brief Runs the same computation with the trip count passed as a kernel
+ *        argument and waits for it
+ */
+void run_runtime(sycl::queue& queue, sycl::buffer<unsigned, 1>& buf,
+                 int iterations) {
+  queue.submit([&](sycl::handler& cgh) {
+    sycl::accessor acc{buf, cgh, sycl::write_only, sycl::no_init};
+    cgh.parallel_for<runtime_kernel>(
+        sycl::range<1>{element_count}, [=](sycl::item<1> item) {
+          acc[item] = transform(static_cast<unsigned>(item[0]), iterations);
+        });
+  });
+  queue.wait_and_throw();
+}
+
+/**
+ * @brief Returns the number of elements of \p buf differing from the host
+ *        computation with \p iterations
+ */
+size_t count_mismatches(sycl::buffer<unsigned, 1>& buf, int iterations) {
+  sycl::host_accessor acc{buf, sycl::read_only};
+  size_t mismatches = 0;
+  for (size_t i = 0; i < element_count; ++i)
+    mismatches += acc[i] != transform(static_cast<unsigned>(i), iterations);
+  return mismatches;
+}
+
+/**
+ * @brief Reports the first and the second visit of every variant
+ */
+void report_visits(const std::string& name, const std::vector<double>& first,
+                   const std::vector<double>& second) {
+  const auto first_stats = benchmark::get_stats(first);
+  const auto second_stats = benchmark::get_stats(second);
+  benchmark::report(name + ", new value", first_stats);
+  benchmark::report(name + ", previously used value", second_stats);
+  const double ratio = first_stats.p50 / second_stats.p50;
+  WARN("[perf] " << name << ": new / previously used value = " << ratio
+                 << (ratio >= cache_hit_ratio
+                         ? "; previously built variants are cached"
+                         : "; no variant cache detected"));
+}
+
+TEST_CASE("Specialization constant rebuild cost and variant cache",
+          "[spec_constants][perf]") {
+  auto queue = once_per_unit::get_queue();
+  const auto context = queue.get_context();
+  const auto device = queue.get_device();
+  sycl::buffer<unsigned, 1> buf{sycl::range<1>{element_count}};
+
+  SECTION("set_specialization_constant and sycl::build") {
+    const auto kernel_id = sycl::get_kernel_id<specialized_kernel>();
+    if (!sycl::has_kernel_bundle<sycl::bundle_state::input>(
+            context, {device}, {kernel_id})) {
+      SKIP("No kernel bundle in input state with the kernel");
+    }
+    if (!device.has(sycl::aspect::online_linker)) {
+      SKIP("Device does not have sycl::aspect::online_linker");
+    }
+    auto input = sycl::get_kernel_bundle<sycl::bundle_state::input>(
+        context, {device}, {kernel_id});
+
+    using executable_bundle =
+        sycl::kernel_bundle<sycl::bundle_state::executable>;
+    std::vector<executable_bundle> variants;
+    std::vector<double> first_ns;
+    std::vector<double> second_ns;
+    for (auto* samples : {&first_ns, &second_ns}) {
+      for (size_t variant = 0; variant < variant_count; ++variant) {
+        samples->push_back(benchmark::time_ns([&] {
+          input.set_specialization_constant<iterations_id>(
+              get_iterations(variant));
+          variants.push_back(sycl::build(input));
+        }));
+      }
+    }
+    report_visits("set_specialization_constant and sycl::build", first_ns,
+                  second_ns);
+
+    std::vector<double> launch_ns;
+    for (size_t variant = 0; variant < variant_count; ++variant) {
+      const auto& bundle = variants[variant];
+      const int iterations = get_iterations(variant);
+      INFO("variant with " << iterations << " iterations");
+      CHECK(bundle.get_specialization_constant<iterations_id>() ==
+            iterations);
+      launch_ns.push_back(benchmark::time_ns([&] {
+        run_specialized(queue, buf, [&](sycl::handler& cgh) {
+          cgh.use_kernel_bundle(bundle);
+        });
+      }));
+      CHECK(count_mismatches(buf, iterations) == 0);
+    }
+    benchmark::report("first launch of a built variant",
+                      benchmark::get_stats(launch_ns));
+  }
+
+  SECTION("handler::set_specialization_constant") {
+    std::vector<double> first_ns;
+    std::vector<double> second_ns;
+    size_t mismatches = 0;
+    for (auto* samples : {&first_ns, &second_ns}) {
+      for (size_t variant = 0; variant < variant_count; ++variant) {
+        const int iterations = get_iterations(variant);
+        samples->push_back(benchmark::time_ns([&] {
+          run_specialized(queue, buf, [&](sycl::handler& cgh) {
+            cgh.set_specialization_constant<iterations_id>(iterations);
+          });
+        }));
+        mismatches += count_mismatches(buf, iterations);
+      }
+    }
+    CHECK(mismatches == 0);
+    report_visits("handler::set_specialization_constant and kernel run",
+                  first_ns, second_ns);
+  }
+
+  SECTION("specialized vs runtime trip count") {
+    for (size_t variant : {size_t{0}, variant_count - 1}) {
+      const int iterations = get_iterations(variant);
+      INFO(iterations << " iterations");
+      auto set_value = [&](sycl::handler& cgh) {
+        cgh.set_specialization_constant<iterations_id>(iterations);
+      };
+      const auto specialized = benchmark::measure(
+          runtime_samples, [&] { run_specialized(queue, buf, set_value); });
+      CHECK(count_mismatches(buf, iterations) == 0);
+      const auto runtime = benchmark::measure(
+          runtime_samples, [&] { run_runtime(queue, buf, iterations); });
+      CHECK(count_mismatches(buf, iterations) == 0);
+
+      const std::string name = std::to_string(iterations) + " iterations";
+      benchmark::report(name + ", specialization constant", specialized,
+                        element_count, "items");
+      benchmark::report(name + ", kernel argument", runtime, element_count,
+                        "items");
+      WARN("[perf] " << name << ": specialized kernel is "
+                     << runtime.p50 / specialized.p50
+                     << "x as fast as the kernel taking an argument");
+    }
+  }
+}
+
+}  // namespace spec_constants_perf
@@ -0,0 +1,408 @@
+/*******************************************************************************
+//
+//  SYCL 2020 Conformance Test Suite
+//
+//  Copyright (c) 2026 The Khronos Group Inc.
+//
+//  Licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//
+//  Measures the cost of sycl::stream output from many work items for several
+//  totalBufferSize and workItemBufferSize values. The kernel writing to the
+//  stream is compared with the same kernel without a stream, and the time
+//  spent on the host after the kernel ends is compared to estimate the flush
+//  latency. The output is captured and parsed: with buffers large enough
+//  every line must be printed exactly once, and with truncating buffers only
+//  lines that were written may be printed.
+//
+*******************************************************************************/
+
+#include "../common/benchmark.h"
+#include "../common/common.h"
+
+#include <algorithm>
+#include <cstdio>
+#include <iostream>
+#include <sstream>
+
+#ifdef __linux__
+#include <unistd.h>
+#endif
+
+namespace stream_perf {
+using namespace sycl_cts::util;
+
+/** Number of work items writing to the stream */
+constexpr size_t item_count = 4096;
+
+/** Number of lines every work item writes */
+constexpr unsigned lines_per_item = 16;
+
+/** Number of timed runs of every configuration */
+constexpr size_t sample_count = 10;
+
+/**
+ * @brief Stream buffer sizes of a configuration
+ */
+struct stream_config {
+  size_t total_buffer_size;
+  size_t work_item_buffer_size;
+  bool truncates;
+};
+
+/**
+ * Lines are at most 8 characters, so 256 bytes hold the output of a work
+ * item and 4 MiB the output of the kernel
+ */
+constexpr stream_config configs[] = {{size_t{16} << 20, 1024, false},
+                                     {size_t{4} << 20, 256, false},
+                                     {size_t{4} << 20, 64, true},
+                                     {size_t{16} << 10, 256, true}};
+
+/**
+ * @brief Redirects the standard output to a temporary file while alive
+ */
+class stdout_capture {
+#ifdef __linux__
+  std::FILE* m_file = nullptr;
+  int m_saved_fd = -1;
+
+  /**
+   * @brief Restores the standard output, does nothing if already restored
+   */
+  void restore() {
+    if (m_saved_fd < 0) return;
+    std::cout.flush();
+    std::fflush(stdout);
+    dup2(m_saved_fd, STDOUT_FILENO);
+    close(m_saved_fd);
+    m_saved_fd = -1;
+  }
+#endif
+
+ public:
+  stdout_capture() {
+#ifdef __linux__
+    std::cout.flush();
+    std::fflush(stdout);
+    m_file = std::tmpfile();
+    if (!m_file) return;
+    m_saved_fd = dup(STDOUT_FILENO);
+    if (m_saved_fd >= 0) dup2(fileno(m_file), STDOUT_FILENO);
+#endif
+  }
+
+  stdout_capture(const stdout_capture&) = delete;
+  stdout_capture& operator=(const stdout_capture&) = delete;
+
+  /**
+   * @brief Restores the standard output if release() was not called, for
+   *        example because the captured code threw
+   */
+  ~stdout_capture() {
+#ifdef __linux__
+    restore();
+    if (m_file) std::fclose(m_file);
+#endif
+  }
+
+  /**
+   * @brief Restores the standard output and returns what was written to it
+   */
+  std::string release() {
+    std::string result;
+#ifdef __linux__
+    restore();
+    if (!m_file) return result;
+    std::rewind(m_file);
+    char chunk[4096];
+    size_t read = 0;
+    while ((read = std::fread(chunk, 1, sizeof(chunk), m_file)) > 0)
+      result.append(chunk, read);
+    std::fclose(m_file);
+    m_file = nullptr;
+#endif
+    return result;
+  }
+
+  static constexpr bool is_supported() {
+#ifdef __linux__
+    return true;
+#else
+    return false;
+#endif
+  }
+};
+
+/**
+ * @brief Value computed by every work item with and without the stream
+ */
+inline unsigned line_value(size_t item, unsigned line) {
+  return static_cast<unsigned>(item) * lines_per_item + line;
+}
+
+/** Characters of the longest line, "4095:15\n", and the terminating null */
+constexpr size_t line_capacity = 9;
+
+/**
+ * @brief Formats the line "<item>:<line>\n" into \p text, so the stream
+ *        receives every line in a single operator<< call and truncation never
+ *        leaves part of a line
+ */
+inline void format_line(char (&text)[line_capacity], unsigned item,
+                        unsigned line) {
+  size_t pos = 0;
+  auto append = [&](unsigned value) {
+    char digits[line_capacity];
+    size_t count = 0;
+    do {
+      digits[count++] = static_cast<char>('0' + value % 10);
+      value /= 10;
+    } while (value != 0);
+    while (count > 0) text[pos++] = digits[--count];
+  };
+  append(item);
+  text[pos++] = ':';
+  append(line);
+  text[pos++] = '\n';
+  text[pos] = '\0';
+}
+
+class stream_kernel;
+class no_stream_kernel;
+
+sycl::event run_kernel(sycl::queue& queue, sycl::buffer<unsigned, 1>& buf,
+                       const stream_config* config) {
+  return queue.submit([&](sycl::handler& cgh) {
+    sycl::accessor acc{buf, cgh, sycl::write_only, sycl::no_init};
+    const sycl::range<1> range{item_count};
+    if (config) {
+      sycl::stream os(config->total_buffer_size,
+                      config->work_item_buffer_size, cgh);
+      cgh.parallel_for<stream_kernel>(range, [=](sycl::id<1> id) {
+        unsigned sum = 0;
+        for (unsigned line = 0; line < lines_per_item; ++line) {
+          sum += line_value(id[0], line);
+          char text[line_capacity];
+          format_line(text, static_cast<unsigned>(id[0]), line);
+          os << text;
+        }
+        acc[id] = sum;
+      });
+    } else {
+      cgh.parallel_for<no_stream_kernel>(range, [=](sycl::id<1> id) {
+        unsigned sum = 0;
+        for (unsigned line = 0; line < lines_per_item; ++line)
+          sum += line_value(id[0], line);
+        acc[id] = sum;
+      });
+    }
+  });
+}
+
+/**
+ * @brief Summary of the captured output
+ */
+struct output_summary {
+  size_t valid = 0;
+  size_t duplicates = 0;
+  size_t malformed = 0;
+  /** Bytes of the valid lines, including the newlines */
+  size_t valid_bytes = 0;
+  /** Work items whose printed lines are not lines 0 to k - 1 for some k */
+  size_t non_prefix_items = 0;
+  /** Work items whose printed lines exceed workItemBufferSize */
+  size_t oversized_items = 0;
+};
+
+output_summary parse_output(const std::string& output,
+                            const stream_config& config) {
+  output_summary summary;
+  std::vector<bool> seen(item_count * lines_per_item, false);
+  std::vector<size_t> item_bytes(item_count, 0);
+  std::istringstream lines(output);
+  std::string text;
+  while (std::getline(lines, text)) {
+    unsigned long item = 0;
+    unsigned long line = 0;
+    char colon = 0;
+    std::istringstream fields(text);
+    if (!(fields >> item >> colon >> line) || colon != ':' ||
+        item >= item_count || line >= lines_per_item ||
+        fields.peek() != std::char_traits<char>::eof()) {
+      ++summary.malformed;
+      continue;
+    }
+    const size_t index = item * lines_per_item + line;
+    if (seen[index]) {
+      ++summary.duplicates;
+    } else {
+      seen[index] = true;
+      ++summary.valid;
+      summary.valid_bytes += text.size() + 1;
+      item_bytes[item] += text.size() + 1;
+    }
+  }
+  for (size_t item = 0; item < item_count; ++item) {
+    const auto first = seen.begin() + item * lines_per_item;
+    const auto last = first + lines_per_item;
+    // Lines after the first missing one must be missing too
+    const auto missing = std::find(first, last, false);
+    summary.non_prefix_items += std::find(missing, last, true) != last;
+    summary.oversized_items += item_bytes[item] > config.work_item_buffer_size;
+  }
+  return summary;
+}
+
+size_t count_mismatches(sycl::buffer<unsigned, 1>& buf) {
+  sycl::host_accessor acc{buf, sycl::read_only};
+  size_t mismatches = 0;
+  for (size_t item = 0; item < item_count; ++item) {
+    unsigned sum = 0;
+    for (unsigned line = 0; line < lines_per_item; ++line)
+      sum += line_value(item, line);
+    mismatches += acc[item] != sum;
+  }
+  return mismatches;
+}
+
+/**
+ * @brief Host round trip and, with profiling, the part of it spent after the
+ *        kernel ended, which includes the stream flush
+ */
+struct run_times {
+  double host_ns;
+  double after_kernel_ns;
+};
+
+run_times time_run(sycl::queue& queue, sycl::buffer<unsigned, 1>& buf,
+                   const stream_config* config, bool profiling) {
+  run_times times{};
+  sycl::event event;
+  times.host_ns = benchmark::time_ns([&] {
+    event = run_kernel(queue, buf, config);
+    queue.wait_and_throw();
+  });
+  if (profiling) {
+    const auto submit =
+        event.get_profiling_info<sycl::info::event_profiling::command_submit>();
+    const auto end =
+        event.get_profiling_info<sycl::info::event_profiling::command_end>();
+    times.after_kernel_ns = times.host_ns - static_cast<double>(end - submit);
+  }
+  return times;
+}
+
+/**
+ * @brief Runs the kernel sample_count times after a warm-up and returns the
+ *        median times
+ */
+run_times measure(sycl::queue& queue, sycl::buffer<unsigned, 1>& buf,
+                  const stream_config* config, bool profiling) {
+  std::vector<double> host_ns;
+  std::vector<double> after_kernel_ns;
+  time_run(queue, buf, config, profiling);
+  for (size_t i = 0; i < sample_count; ++i) {
+    const auto times = time_run(queue, buf, config, profiling);
+    host_ns.push_back(times.host_ns);
+    after_kernel_ns.push_back(times.after_kernel_ns);
+  }
+  return {benchmark::get_stats(host_ns).p50,
+          benchmark::get_stats(after_kernel_ns).p50};
+}
+
+TEST_CASE("sycl::stream throughput and buffer size scaling",
+          "[stream][perf]") {
+  const auto device = get_cts_object::device();
+  const bool profiling = device.has(sycl::aspect::queue_profiling);
+  sycl::property_list properties;
+  if (profiling) properties = {sycl::property::queue::enable_profiling()};
+  sycl::queue queue(device, properties);
+  sycl::buffer<unsigned, 1> buf{sycl::range<1>{item_count}};
+  const size_t line_count = item_count * lines_per_item;
+
+  const auto baseline = measure(queue, buf, nullptr, profiling);
+  CHECK(count_mismatches(buf) == 0);
+  WARN("[perf] kernel without stream: "
+       << benchmark::format_duration(baseline.host_ns));
+
+  for (const auto& config : configs) {
+    std::ostringstream name;
+    name << "totalBufferSize "
+         << benchmark::format_bytes(
+                static_cast<double>(config.total_buffer_size))
+         << ", workItemBufferSize " << config.work_item_buffer_size;
+    INFO(name.str());
+
+    // The output of the timed runs is captured too, so the terminal does
+    // not slow the flush down
+    run_times times{};
+    std::string output;
+    {
+      stdout_capture capture;
+      times = measure(queue, buf, &config, profiling);
+      static_cast<void>(capture.release());
+    }
+    {
+      stdout_capture capture;
+      run_kernel(queue, buf, &config);
+      queue.wait_and_throw();
+      output = capture.release();
+    }
+    CHECK(count_mismatches(buf) == 0);
+
+    std::ostringstream flush;
+    if (profiling) {
+      flush << ", host time after kernel end "
+            << benchmark::format_duration(times.after_kernel_ns) << " vs "
+            << benchmark::format_duration(baseline.after_kernel_ns)
+            << " without stream";
+    }
+    WARN("[perf] " << name.str() << ": "
+                   << benchmark::format_duration(times.host_ns) << ", "
+                   << times.host_ns / baseline.host_ns
+                   << "x the kernel without stream, "
+                   << benchmark::format_rate(
+                          static_cast<double>(line_count), times.host_ns,
+                          "lines")
+                   << flush.str());
+
+    if (!stdout_capture::is_supported()) continue;
+    const auto summary = parse_output(output, config);
+    CHECK(summary.duplicates == 0);
+    CHECK(summary.valid > 0);
+    CHECK(summary.oversized_items == 0);
+    CHECK(summary.valid_bytes <= config.total_buffer_size);
+    if (config.truncates) {
+      // Lines are written whole, so a work item's output is dropped from its
+      // end when its own buffer is full. An implementation cutting a line
+      // instead, either at the end of the work item buffer or where the total
+      // buffer runs out, leaves a fragment that merges with the next output
+      // and breaks at most one prefix per malformed line. Running out of the
+      // total buffer may additionally cut the output of one work item.
+      const bool total_fits = config.total_buffer_size >=
+                              item_count * config.work_item_buffer_size;
+      CHECK(summary.non_prefix_items <=
+            summary.malformed + (total_fits ? 0 : 1));
+    } else {
+      CHECK(summary.valid == line_count);
+      CHECK(summary.malformed == 0);
+      CHECK(summary.non_prefix_items == 0);
+    }
+    WARN("[perf] " << name.str() << ": " << summary.valid << " of "
+                   << line_count << " lines printed ("
+                   << 100.0 * summary.valid / line_count << "%), "
+                   << summary.malformed << " malformed");
+  }
+}
+
+}  // namespace stream_perf
@@ -0,0 +1,314 @@
+/*******************************************************************************
+//
+//  SYCL 2020 Conformance Test Suite
+//
+//  Copyright (c) 2026 The Khronos Group Inc.
+//
+//  Licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//
+//  Stress test for USM allocation functions. Several host threads run
+//  allocate/free cycles of mixed sizes and allocation kinds concurrently,
+//  keeping a small number of allocations alive at any time to fragment the
+//  memory. The test reports latency distributions, peak resident set size and
+//  whether freed addresses are reused by the runtime. It also checks whether
+//  sycl::free() waits for unrelated kernels to complete.
+//
+*******************************************************************************/
+
+#include "../common/benchmark.h"
+#include "../common/common.h"
+#include "../common/once_per_unit.h"
+
+#include <cstdint>
+#include <random>
+#include <thread>
+#include <unordered_set>
+
+namespace usm_allocate_free_perf {
+using namespace sycl_cts::util;
+
+/**
+ * Total number of allocate/free cycles, split among the threads. Every cycle
+ * allocates once and, sooner or later, frees the allocation.
+ */
+constexpr size_t total_cycles = 4000000;
+
+/** Upper limit of the number of host threads */
+constexpr size_t max_thread_count = 8;
+
+/** Maximum number of allocations alive in a thread at the same time */
+constexpr size_t max_live_allocations = 16;
+
+/** Allocation sizes are chosen between 8 bytes and 1 MiB */
+constexpr int min_size_log2 = 3;
+constexpr int max_size_log2 = 20;
+
+enum class usm_function : int {
+  malloc_device = 0,
+  malloc_shared,
+  malloc_host,
+  aligned_alloc,
+  function_count  // defines size, should be last
+};
+
+constexpr size_t function_count = to_integral(usm_function::function_count);
+
+std::string get_function_name(usm_function function) {
+  switch (function) {
+    case usm_function::malloc_device:
+      return "malloc_device";
+    case usm_function::malloc_shared:
+      return "malloc_shared";
+    case usm_function::malloc_host:
+      return "malloc_host";
+    default:
+      return "aligned_alloc";
+  }
+}
+
+/**
+ * @brief Results collected by a single host thread. Catch2 assertions are not
+ *        thread-safe, so the checks are done after the threads are joined.
+ */
+struct thread_result {
+  std::vector<double> alloc_ns[function_count];
+  std::vector<double> free_ns;
+  std::unordered_set<const void*> addresses;
+  size_t allocations = 0;
+  size_t failures = 0;
+  size_t misaligned = 0;
+};
+
+void run_cycles(sycl::queue& queue,
+                const std::vector<sycl::usm::alloc>& kinds, size_t cycles,
+                unsigned seed, thread_result& result) {
+  std::mt19937 gen(seed);
+  std::uniform_int_distribution<int> size_log2(min_size_log2, max_size_log2);
+  std::uniform_int_distribution<size_t> kind_index(0, kinds.size() - 1);
+  std::bernoulli_distribution alloc_next(0.5);
+  const size_t alignments[] = {64, 4096};
+  std::uniform_int_distribution<size_t> alignment_index(0, 1);
+  const auto context = queue.get_context();
+  std::vector<void*> live;
+  live.reserve(max_live_allocations);
+
+  auto free_one = [&](size_t index) {
+    void* ptr = live[index];
+    live[index] = live.back();
+    live.pop_back();
+    result.free_ns.push_back(
+        benchmark::time_ns([&] { sycl::free(ptr, context); }));
+  };
+
+  for (size_t cycle = 0; cycle < cycles;) {
+    if (live.size() == max_live_allocations ||
+        (!live.empty() && !alloc_next(gen))) {
+      std::uniform_int_distribution<size_t> index(0, live.size() - 1);
+      free_one(index(gen));
+      continue;
+    }
+
+    const size_t base = size_t{1} << size_log2(gen);
+    const size_t bytes =
+        base + std::uniform_int_distribution<size_t>(0, base - 1)(gen);
+    const auto kind = kinds[kind_index(gen)];
+    // Every fourth allocation goes through aligned_alloc
+    const bool aligned = cycle++ % 4 == 3;
+    const size_t alignment = alignments[alignment_index(gen)];
+    usm_function function = usm_function::aligned_alloc;
+    if (!aligned) {
+      if (kind == sycl::usm::alloc::device)
+        function = usm_function::malloc_device;
+      else if (kind == sycl::usm::alloc::shared)
+        function = usm_function::malloc_shared;
+      else
+        function = usm_function::malloc_host;
+    }
+
+    void* ptr = nullptr;
+    const double ns = benchmark::time_ns([&] {
+      switch (function) {
+        case usm_function::malloc_device:
+          ptr = sycl::malloc_device(bytes, queue);
+          break;
+        case usm_function::malloc_shared:
+          ptr = sycl::malloc_shared(bytes, queue);
+          break;
+        case usm_function::malloc_host:
+          ptr = sycl::malloc_host(bytes, queue);
+          break;
+        default:
+          ptr = sycl::aligned_alloc(alignment, bytes, queue, kind);
+          break;
+      }
+    });
+    ++result.allocations;
+    if (ptr == nullptr) {
+      ++result.failures;
+      continue;
+    }
+    result.alloc_ns[to_integral(function)].push_back(ns);
+    if (aligned && reinterpret_cast<std::uintptr_t>(ptr) % alignment != 0)
+      ++result.misaligned;
+    result.addresses.insert(ptr);
+    live.push_back(ptr);
+  }
+  while (!live.empty()) free_one(live.size() - 1);
+}
+
+class long_kernel;
+
+/** Upper limit of the iterations of the long kernel */
+constexpr size_t max_kernel_iterations = size_t{1} << 40;
+
+/**
+ * @brief Checks whether sycl::free() of an unrelated allocation returns
+ *        before a long-running kernel completes
+ */
+void check_free_during_kernel(sycl::queue& queue) {
+  const auto kind = queue.get_device().has(sycl::aspect::usm_device_allocations)
+                        ? sycl::usm::alloc::device
+                        : sycl::usm::alloc::host;
+  const auto idle_free = benchmark::measure(
+      benchmark::default_sample_count, [&] {
+        void* ptr = sycl::malloc(1024, queue, kind);
+        sycl::free(ptr, queue);
+      });
+
+  size_t iterations = size_t{1} << 16;
+  sycl::buffer<size_t, 1> buf{sycl::range<1>{1}};
+  auto submit = [&] {
+    return queue.submit([&](sycl::handler& cgh) {
+      sycl::accessor acc{buf, cgh, sycl::write_only, sycl::no_init};
+      cgh.single_task<long_kernel>([=] {
+        size_t value = 1;
+        for (size_t i = 0; i < iterations; ++i)
+          value = value * 6364136223846793005ull + 1442695040888963407ull;
+        acc[0] = value;
+      });
+    });
+  };
+  // The kernel has to run much longer than free() itself, so a kernel
+  // completed by the time free() returns was waited for
+  double kernel_ns = benchmark::time_ns([&] { submit().wait(); });
+  while (kernel_ns < 100 * idle_free.p50 &&
+         iterations < max_kernel_iterations) {
+    iterations *= 2;
+    kernel_ns = benchmark::time_ns([&] { submit().wait(); });
+  }
+
+  void* ptr = sycl::malloc(1024, queue, kind);
+  REQUIRE(ptr != nullptr);
+  auto is_complete = [](const sycl::event& event) {
+    return event.get_info<sycl::info::event::command_execution_status>() ==
+           sycl::info::event_command_status::complete;
+  };
+  auto event = submit();
+  const bool done_before_free = is_complete(event);
+  const double busy_free_ns =
+      benchmark::time_ns([&] { sycl::free(ptr, queue); });
+  const bool done_after_free = is_complete(event);
+  event.wait_and_throw();
+
+  const char* verdict = "; free did not wait for the kernel";
+  if (done_before_free)
+    verdict = "; kernel had completed before free, result inconclusive";
+  else if (done_after_free)
+    verdict =
+        "; kernel had completed when free returned, free may be a "
+        "synchronization point";
+  WARN("[perf] sycl::free during a running kernel: "
+       << benchmark::format_duration(busy_free_ns) << ", idle alloc + free p50 "
+       << benchmark::format_duration(idle_free.p50) << ", kernel "
+       << benchmark::format_duration(kernel_ns) << verdict);
+}
+
+TEST_CASE("USM allocation and deallocation stress", "[usm][perf]") {
+  auto queue = once_per_unit::get_queue();
+  const auto device = queue.get_device();
+
+  std::vector<sycl::usm::alloc> kinds;
+  if (device.has(sycl::aspect::usm_device_allocations))
+    kinds.push_back(sycl::usm::alloc::device);
+  if (device.has(sycl::aspect::usm_shared_allocations))
+    kinds.push_back(sycl::usm::alloc::shared);
+  if (device.has(sycl::aspect::usm_host_allocations))
+    kinds.push_back(sycl::usm::alloc::host);
+  if (kinds.empty()) {
+    SKIP("Device does not support USM allocations");
+  }
+
+  const size_t thread_count = std::clamp<size_t>(
+      std::thread::hardware_concurrency(), 1, max_thread_count);
+  const size_t cycles = total_cycles / thread_count;
+  const size_t rss_before = benchmark::get_current_rss();
+
+  std::vector<thread_result> results(thread_count);
+  std::vector<std::thread> threads;
+  const double total_ns = benchmark::time_ns([&] {
+    for (size_t t = 0; t < thread_count; ++t)
+      threads.emplace_back(run_cycles, std::ref(queue), std::cref(kinds),
+                           cycles, static_cast<unsigned>(t + 1),
+                           std::ref(results[t]));
+    for (auto& thread : threads) thread.join();
+  });
+  const size_t rss_after = benchmark::get_current_rss();
+
+  std::vector<double> alloc_ns[function_count];
+  std::vector<double> free_ns;
+  std::unordered_set<const void*> addresses;
+  size_t allocations = 0;
+  size_t failures = 0;
+  size_t misaligned = 0;
+  for (auto& result : results) {
+    for (size_t f = 0; f < function_count; ++f)
+      alloc_ns[f].insert(alloc_ns[f].end(), result.alloc_ns[f].begin(),
+                         result.alloc_ns[f].end());
+    free_ns.insert(free_ns.end(), result.free_ns.begin(),
+                   result.free_ns.end());
+    addresses.insert(result.addresses.begin(), result.addresses.end());
+    allocations += result.allocations;
+    failures += result.failures;
+    misaligned += result.misaligned;
+  }
+  CHECK(failures == 0);
+  CHECK(misaligned == 0);
+
+  const std::string config = std::to_string(thread_count) + " thread(s), " +
+                             std::to_string(allocations) + " allocations";
+  for (size_t f = 0; f < function_count; ++f) {
+    if (alloc_ns[f].empty()) continue;
+    benchmark::report(
+        get_function_name(static_cast<usm_function>(f)) + ", " + config,
+        benchmark::get_stats(alloc_ns[f]));
+  }
+  benchmark::report("free, " + config, benchmark::get_stats(free_ns));
+  WARN("[perf] " << config << ": "
+                 << benchmark::format_rate(
+                        static_cast<double>(allocations + free_ns.size()),
+                        total_ns, "calls")
+                 << ", peak RSS "
+                 << benchmark::format_bytes(benchmark::get_peak_rss())
+                 << ", RSS growth "
+                 << benchmark::format_bytes(static_cast<double>(rss_after) -
+                                            static_cast<double>(rss_before)));
+  WARN("[perf] " << config << ": " << addresses.size()
+                 << " distinct addresses, memory is "
+                 << (addresses.size() < allocations - failures
+                         ? "recycled by the runtime"
+                         : "never recycled by the runtime"));
+
+  check_free_during_kernel(queue);
+}
+
+}  // namespace usm_allocate_free_perf
@@ -0,0 +1,174 @@
+/*******************************************************************************
+//
+//  SYCL 2020 Conformance Test Suite
+//
+//  Copyright (c) 2026 The Khronos Group Inc.
+//
+//  Licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//
+//  Measures the cost of sycl::usm_allocator in standard containers. Every
+//  workload is run with std::allocator, usm_allocator<alloc::shared> and
+//  usm_allocator<alloc::host>, and the overhead is reported relative to
+//  std::allocator.
+//
+*******************************************************************************/
+
+#include "../../util/usm_helper.h"
+#include "../common/benchmark.h"
+#include "../common/common.h"
+#include "../common/once_per_unit.h"
+
+#include <deque>
+#include <list>
+#include <map>
+#include <memory>
+#include <numeric>
+#include <vector>
+
+namespace usm_allocator_perf {
+using namespace sycl_cts::util;
+
+/** Number of elements pushed by the vector and deque workloads */
+constexpr size_t sequence_elements = size_t{1} << 20;
+
+/** Number of elements inserted by the node-based workloads */
+constexpr size_t node_elements = size_t{1} << 17;
+
+/** Number of elements the deque workload keeps alive */
+constexpr size_t deque_window = 1024;
+
+/** Number of timed runs of every workload */
+constexpr size_t sample_count = 10;
+
+template <typename AllocatorT, typename T>
+using rebind_t =
+    typename std::allocator_traits<AllocatorT>::template rebind_alloc<T>;
+
+/**
+ * @brief push_back without reserve, so the storage is reallocated
+ *        log2(sequence_elements) times
+ */
+template <typename AllocatorT>
+size_t vector_push_back(const AllocatorT& alloc) {
+  std::vector<size_t, AllocatorT> values(alloc);
+  for (size_t i = 0; i < sequence_elements; ++i) values.push_back(i);
+  return std::accumulate(values.begin(), values.end(), size_t{0});
+}
+
+/**
+ * @brief Queue-like usage: pushes to the back and pops from the front, so
+ *        deque blocks are allocated and released continuously
+ */
+template <typename AllocatorT>
+size_t deque_push_pop(const AllocatorT& alloc) {
+  std::deque<size_t, AllocatorT> values(alloc);
+  size_t sum = 0;
+  for (size_t i = 0; i < sequence_elements; ++i) {
+    values.push_back(i);
+    if (values.size() > deque_window) {
+      sum += values.front();
+      values.pop_front();
+    }
+  }
+  return std::accumulate(values.begin(), values.end(), sum);
+}
+
+/**
+ * @brief One node allocation per insertion and a release for every other one
+ */
+template <typename AllocatorT>
+size_t list_insert_erase(const AllocatorT& alloc) {
+  std::list<size_t, AllocatorT> values(alloc);
+  size_t sum = 0;
+  for (size_t i = 0; i < node_elements; ++i) {
+    values.push_back(i);
+    if (i % 2 == 1) {
+      sum += values.front();
+      values.pop_front();
+    }
+  }
+  return std::accumulate(values.begin(), values.end(), sum);
+}
+
+template <typename AllocatorT>
+size_t map_insert_erase(const AllocatorT& alloc) {
+  using value_type = std::pair<const size_t, size_t>;
+  std::map<size_t, size_t, std::less<size_t>, rebind_t<AllocatorT, value_type>>
+      values(alloc);
+  size_t sum = 0;
+  for (size_t i = 0; i < node_elements; ++i) {
+    // Spread the keys so insertions rebalance the tree
+    values.emplace((i * 2654435761u) % node_elements, i);
+    if (i % 2 == 1) {
+      sum += values.begin()->second;
+      values.erase(values.begin());
+    }
+  }
+  for (const auto& value : values) sum += value.first + value.second;
+  return sum;
+}
+
+/**
+ * @brief Runs \p workload with every allocator supported by the device and
+ *        reports the overhead multiplier relative to std::allocator
+ * @param workload Generic callable taking an allocator of size_t and
+ *        returning a checksum
+ */
+template <typename WorkloadT>
+void measure_workload(sycl::queue& queue, const std::string& name,
+                      WorkloadT&& workload) {
+  INFO(name);
+  size_t expected = 0;
+  const auto baseline = benchmark::measure(sample_count, [&] {
+    expected = workload(std::allocator<size_t>{});
+  });
+  benchmark::report(name + ", std::allocator", baseline);
+
+  auto measure_usm = [&](auto kind_tag) {
+    constexpr sycl::usm::alloc kind = decltype(kind_tag)::value;
+    const std::string description =
+        name + ", usm_allocator<" +
+        std::string(usm_helper::get_allocation_description<kind>()) + ">";
+    if (!queue.get_device().has(usm_helper::get_aspect<kind>())) {
+      WARN("Device does not support " << description << ". Skipping.");
+      return;
+    }
+    const sycl::usm_allocator<size_t, kind> alloc{queue};
+    size_t checksum = 0;
+    const auto stats = benchmark::measure(
+        sample_count, [&] { checksum = workload(alloc); });
+    CHECK(checksum == expected);
+    benchmark::report(description, stats);
+    WARN("[perf] " << description << ": " << stats.p50 / baseline.p50
+                   << "x std::allocator");
+  };
+  measure_usm(std::integral_constant<sycl::usm::alloc,
+                                     sycl::usm::alloc::shared>{});
+  measure_usm(
+      std::integral_constant<sycl::usm::alloc, sycl::usm::alloc::host>{});
+}
+
+TEST_CASE("usm_allocator overhead in standard containers", "[usm][perf]") {
+  auto queue = once_per_unit::get_queue();
+
+  measure_workload(queue, "std::vector push_back",
+                   [](const auto& alloc) { return vector_push_back(alloc); });
+  measure_workload(queue, "std::deque push_back/pop_front",
+                   [](const auto& alloc) { return deque_push_pop(alloc); });
+  measure_workload(queue, "std::list push_back/pop_front",
+                   [](const auto& alloc) { return list_insert_erase(alloc); });
+  measure_workload(queue, "std::map emplace/erase",
+                   [](const auto& alloc) { return map_insert_erase(alloc); });
+}
+
+}  // namespace usm_allocator_perf
@@ -0,0 +1,332 @@
+/*******************************************************************************
+//
+//  SYCL 2020 Conformance Test Suite
+//
+//  Copyright (c) 2026 The Khronos Group Inc.
+//
+//  Licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//
+//  Benchmark variant of the usm_api tests: memcpy(), copy(), memset(),
+//  fill(), prefetch() and mem_advise() are timed for every allocation type
+//  with runtime sizes from 64 bytes up to 1 GiB. Small transfers are reported
+//  as latency, large ones as bandwidth.
+//
+*******************************************************************************/
+
+#include "../common/benchmark.h"
+#include "../common/once_per_unit.h"
+#include "usm_api.h"
+
+#include <cstring>
+#include <functional>
+#include <memory>
+
+namespace usm_api_perf {
+using namespace sycl_cts::util;
+using namespace usm_api;
+
+/** Smallest transfer size, bytes */
+constexpr size_t min_bytes = 64;
+
+/** Largest transfer size, bytes */
+constexpr size_t max_bytes = size_t{1} << 30;
+
+/** Transfers up to this size are reported as latency, larger as bandwidth */
+constexpr size_t latency_bytes_limit = 64 * 1024;
+
+/** Value used by the fill() measurements */
+constexpr int fill_value = 0x01020304;
+
+/** Byte used by the memset() measurements */
+constexpr int memset_value = 0x5a;
+
+constexpr allocation allocations[] = {allocation::non_usm, allocation::host,
+                                      allocation::device, allocation::shared};
+
+/**
+ * @brief Describes how the operation is submitted: through the queue or the
+ *        handler member function, with the given number of dependency events
+ */
+struct entry_point {
+  const char* name;
+  bool use_handler;
+  size_t event_count;
+};
+
+constexpr entry_point entry_points[] = {{"queue", false, 0_events},
+                                        {"queue, 1 event", false, 1_events},
+                                        {"queue, 10 events", false,
+                                         multiple_events},
+                                        {"handler", true, 0_events}};
+
+using usm_ptr =
+    std::unique_ptr<unsigned char, std::function<void(unsigned char*)>>;
+
+class dependency_kernel;
+
+std::string get_allocation_name(allocation alloc) {
+  switch (alloc) {
+    case allocation::non_usm:
+      return get_allocation_decription<allocation::non_usm>();
+    case allocation::host:
+      return get_allocation_decription<allocation::host>();
+    case allocation::device:
+      return get_allocation_decription<allocation::device>();
+    default:
+      return get_allocation_decription<allocation::shared>();
+  }
+}
+
+bool is_supported(const sycl::queue& queue, allocation alloc) {
+  const auto device = queue.get_device();
+  switch (alloc) {
+    case allocation::host:
+      return device.has(sycl::aspect::usm_host_allocations);
+    case allocation::device:
+      return device.has(sycl::aspect::usm_device_allocations);
+    case allocation::shared:
+      return device.has(sycl::aspect::usm_shared_allocations);
+    default:
+      return true;
+  }
+}
+
+/**
+ * @brief Allocates \p bytes of memory of the given allocation type, returns
+ *        null pointer if the allocation failed
+ */
+usm_ptr allocate(sycl::queue& queue, allocation alloc, size_t bytes) {
+  if (alloc == allocation::non_usm)
+    return usm_ptr(new (std::nothrow) unsigned char[bytes],
+                   [](unsigned char* ptr) { delete[] ptr; });
+
+  sycl::usm::alloc kind = sycl::usm::alloc::shared;
+  if (alloc == allocation::host)
+    kind = sycl::usm::alloc::host;
+  else if (alloc == allocation::device)
+    kind = sycl::usm::alloc::device;
+  const auto context = queue.get_context();
+  return usm_ptr(static_cast<unsigned char*>(sycl::malloc(bytes, queue, kind)),
+                 [context](unsigned char* ptr) { sycl::free(ptr, context); });
+}
+
+std::string format_size(size_t bytes) {
+  if (bytes >= (size_t{1} << 30))
+    return std::to_string(bytes >> 30) + " GiB";
+  if (bytes >= (size_t{1} << 20))
+    return std::to_string(bytes >> 20) + " MiB";
+  if (bytes >= (size_t{1} << 10))
+    return std::to_string(bytes >> 10) + " KiB";
+  return std::to_string(bytes) + " B";
+}
+
+size_t get_sample_count(size_t bytes) {
+  if (bytes <= latency_bytes_limit) return benchmark::default_sample_count;
+  return bytes <= (size_t{64} << 20) ? 20 : 5;
+}
+
+/**
+ * @brief Returns \p count completed events to pass as dependencies, so the
+ *        measurement shows the cost of handling them and not of waiting
+ */
+std::vector<sycl::event> get_dependencies(sycl::queue& queue, size_t count) {
+  std::vector<sycl::event> events;
+  for (size_t i = 0; i < count; ++i)
+    events.push_back(queue.single_task<dependency_kernel>([] {}));
+  sycl::event::wait_and_throw(events);
+  return events;
+}
+
+/**
+ * @brief Submits the operation through \p entry and waits for its completion
+ * @param action Generic callable taking the queue or the handler followed by
+ *        the dependency events, if any
+ */
+template <typename ActionT>
+void run_operation(sycl::queue& queue, const entry_point& entry,
+                   const std::vector<sycl::event>& events, ActionT&& action) {
+  if (entry.use_handler) {
+    queue.submit([&](sycl::handler& cgh) { action(cgh); });
+    queue.wait_and_throw();
+  } else if (events.empty()) {
+    action(queue).wait_and_throw();
+  } else if (events.size() == 1) {
+    action(queue, events[0]).wait_and_throw();
+  } else {
+    action(queue, events).wait_and_throw();
+  }
+}
+
+std::vector<unsigned char> read_back(sycl::queue& queue,
+                                     const unsigned char* ptr, size_t bytes) {
+  std::vector<unsigned char> result(bytes);
+  queue.memcpy(result.data(), ptr, bytes).wait_and_throw();
+  return result;
+}
+
+/**
+ * @brief Sets \p bytes of \p ptr to zero. No operation measured produces
+ *        only zeros, so a following operation doing nothing is detected by the
+ *        check.
+ */
+void poison(sycl::queue& queue, allocation alloc, unsigned char* ptr,
+            size_t bytes) {
+  if (alloc == allocation::non_usm)
+    std::memset(ptr, 0, bytes);
+  else
+    queue.memset(ptr, 0, bytes).wait_and_throw();
+}
+
+/**
+ * @brief Measures a single operation for every entry point and checks the
+ *        result of the last run
+ * @param reset Callable run before every entry point to overwrite the
+ *        destination with data the operation cannot produce, may be empty
+ * @param check Callable verifying the destination memory, may be empty
+ */
+template <typename ActionT>
+void measure_operation(sycl::queue& queue, const std::string& description,
+                       size_t bytes, ActionT&& action,
+                       const std::function<void()>& reset,
+                       const std::function<void()>& check) {
+  for (const auto& entry : entry_points) {
+    // Dependency handling only matters for the latency of small transfers
+    if (entry.event_count > 0 && bytes > latency_bytes_limit) continue;
+    const auto events = get_dependencies(queue, entry.event_count);
+    const std::string name =
+        description + ", " + format_size(bytes) + ", " + entry.name;
+    INFO(name);
+
+    if (reset) reset();
+    const auto stats = benchmark::measure(get_sample_count(bytes), [&] {
+      run_operation(queue, entry, events, action);
+    });
+    if (bytes <= latency_bytes_limit)
+      benchmark::report(name, stats);
+    else
+      benchmark::report(name, stats, static_cast<double>(bytes), "B");
+    if (check) check();
+  }
+}
+
+void measure_size(sycl::queue& queue, size_t bytes) {
+  std::vector<unsigned char> pattern(bytes);
+  for (size_t i = 0; i < bytes; ++i)
+    pattern[i] = static_cast<unsigned char>(i * 7 + 1);
+
+  for (allocation dst_alloc : allocations) {
+    if (!is_supported(queue, dst_alloc)) continue;
+    const std::string dst_name = get_allocation_name(dst_alloc);
+
+    for (allocation src_alloc : allocations) {
+      if (!is_supported(queue, src_alloc)) continue;
+      if (src_alloc == allocation::non_usm && dst_alloc == allocation::non_usm)
+        continue;
+      auto src = allocate(queue, src_alloc, bytes);
+      auto dst = allocate(queue, dst_alloc, bytes);
+      if (!src || !dst) {
+        WARN("Unable to allocate " << format_size(bytes) << ". Skipping.");
+        continue;
+      }
+      queue.memcpy(src.get(), pattern.data(), bytes).wait_and_throw();
+      const auto reset_copy = [&] {
+        poison(queue, dst_alloc, dst.get(), bytes);
+      };
+      const auto check_copy = [&] {
+        CHECK(read_back(queue, dst.get(), bytes) == pattern);
+      };
+
+      const std::string from_to =
+          " from " + get_allocation_name(src_alloc) + " to " + dst_name;
+      measure_operation(
+          queue, "memcpy" + from_to, bytes,
+          [&](auto& parent, auto&&... events) {
+            return parent.memcpy(dst.get(), src.get(), bytes, events...);
+          },
+          reset_copy, check_copy);
+      const size_t count = bytes / sizeof(int);
+      measure_operation(
+          queue, "copy<int>" + from_to, bytes,
+          [&](auto& parent, auto&&... events) {
+            return parent.copy(reinterpret_cast<const int*>(src.get()),
+                               reinterpret_cast<int*>(dst.get()), count,
+                               events...);
+          },
+          reset_copy, check_copy);
+    }
+
+    // The remaining operations require USM pointers
+    if (dst_alloc == allocation::non_usm) continue;
+    auto dst = allocate(queue, dst_alloc, bytes);
+    if (!dst) {
+      WARN("Unable to allocate " << format_size(bytes) << ". Skipping.");
+      continue;
+    }
+
+    const auto reset_usm = [&] { poison(queue, dst_alloc, dst.get(), bytes); };
+
+    measure_operation(
+        queue, "memset using " + dst_name, bytes,
+        [&](auto& parent, auto&&... events) {
+          return parent.memset(dst.get(), memset_value, bytes, events...);
+        },
+        reset_usm, [&] {
+          const auto result = read_back(queue, dst.get(), bytes);
+          CHECK(std::all_of(result.begin(), result.end(), [](unsigned char v) {
+            return v == static_cast<unsigned char>(memset_value);
+          }));
+        });
+    const size_t count = bytes / sizeof(int);
+    measure_operation(
+        queue, "fill<int> using " + dst_name, bytes,
+        [&](auto& parent, auto&&... events) {
+          return parent.fill(reinterpret_cast<int*>(dst.get()), fill_value,
+                             count, events...);
+        },
+        reset_usm, [&] {
+          const auto result = read_back(queue, dst.get(), bytes);
+          std::vector<int> values(count);
+          std::memcpy(values.data(), result.data(), bytes);
+          CHECK(std::all_of(values.begin(), values.end(),
+                            [](int v) { return v == fill_value; }));
+        });
+    // Effects of prefetch() and mem_advise() are implementation-defined
+    measure_operation(
+        queue, "prefetch using " + dst_name, bytes,
+        [&](auto& parent, auto&&... events) {
+          return parent.prefetch(dst.get(), bytes, events...);
+        },
+        {}, {});
+    measure_operation(
+        queue, "mem_advise using " + dst_name, bytes,
+        [&](auto& parent, auto&&... events) {
+          return parent.mem_advise(dst.get(), bytes, 0, events...);
+        },
+        {}, {});
+  }
+}
+
+TEST_CASE("USM memcpy, copy, memset, fill, prefetch and mem_advise bandwidth",
+          "[usm][perf]") {
+  auto queue = once_per_unit::get_queue();
+  const auto device = queue.get_device();
+  // Source, destination and two host copies have to fit at the same time
+  const size_t limit = std::min<size_t>(
+      {max_bytes, device.get_info<sycl::info::device::max_mem_alloc_size>(),
+       device.get_info<sycl::info::device::global_mem_size>() / 4});
+
+  for (size_t bytes = min_bytes; bytes <= limit; bytes *= 4)
+    measure_size(queue, bytes);
+}
+
+}  // namespace usm_api_perf